@@ -0,0 +1,240 @@
+#!/usr/bin/env python3
+"""Runs the benchmark corpus and compares it against a stored baseline.
+
+Every case runs under both engines, once to warm up and then --runs
+times. For each one the table gives the median wall time and its
+variance, the median peak RSS, and the bytes allocated on the
+collected heap (from --mem-stats and --gc-stats). A median that grows past the
+tolerance over the baseline is flagged, and the exit status is 1.
+
+After the table comes the throughput of --jobs: the corpus is run
+several times over in one process on 1, 2, 4, ... threads, up to the
+number of CPUs, in scripts per second.
+
+The cases are the scripts in bench/cases and a few generated ones:
+a huge straight-line script, many small functions, and a script that
+is almost only parsed. The baseline belongs to one machine and build,
+so refresh it with --update after a change that is meant to move it,
+or when moving to another machine. Build optimised first:
+
+  make clean && make CFLAGS="-std=c++11 -O2" bench
+
+usage: bench.py [--runs N] [--update] [--baseline FILE] [--tolerance F]
+                [--run PATH] [--no-jobs] [case ...]
+"""
+
+import argparse
+import json
+import os
+import re
+import shutil
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+ENGINES = ["ast", "vm"]
+# allowed growth over the baseline, as a fraction; time is given on the
+# command line, memory is steadier
+RSS_TOLERANCE = 0.10
+ALLOC_TOLERANCE = 0.02
+
+
+def straight_line(n=20000):
+    lines = ["v0 = 1"]
+    for i in range(1, n):
+        lines.append("v%d = v%d * 3 %% 1000003 + %d" % (i, i - 1, i))
+        if i % 1000 == 0:
+            lines.append("print v%d" % i)
+    return "\n".join(lines) + "\n"
+
+
+def many_funcs(n=2000):
+    lines = []
+    for i in range(n):
+        lines.append("def f%d(x):" % i)
+        lines.append("    return x * %d %% 1009 + %d" % (i % 7 + 1, i))
+    lines.append("t = 0")
+    for i in range(n):
+        lines.append("t = f%d(t)" % i)
+    lines.append("print t")
+    return "\n".join(lines) + "\n"
+
+
+def parse_only(n=3000):
+    lines = []
+    for i in range(n):
+        lines.append("def g%d(a, b, c):" % i)
+        lines.append("    if a < b:")
+        lines.append("        if b < c:")
+        lines.append("            return a * b + c - %d * a // 3 + b %% 7" % i)
+        lines.append("        return 'str%d' + 'ing'" % i)
+        lines.append("    x = a + b * c - a / 2.5 + %d" % i)
+        lines.append("    return g%d(x, b, c)" % i)
+    lines.append("print %d" % n)
+    return "\n".join(lines) + "\n"
+
+
+GENERATED = {
+    "straight_line": straight_line,
+    "many_funcs": many_funcs,
+    "parse_only": parse_only,
+}
+
+
+def corpus(gendir):
+    cases = {}
+    for name in sorted(os.listdir(os.path.join(HERE, "cases"))):
+        if name.endswith(".py"):
+            cases[name[:-3]] = os.path.join(HERE, "cases", name)
+    for name, make in sorted(GENERATED.items()):
+        path = os.path.join(gendir, name + ".py")
+        with open(path, "w") as out:
+            out.write(make())
+        cases[name] = path
+    return cases
+
+
+def run_once(run, engine, path):
+    """Wall seconds, peak RSS in KB and heap bytes allocated by one run."""
+    args = [run, "--engine=" + engine, "--no-cache", "--mem-stats", "--gc-stats",
+            "--recursion-limit=10000", path]
+    start = time.perf_counter()
+    proc = subprocess.Popen(args, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE)
+    err = proc.stderr.read().decode("utf-8", "replace")
+    proc.stderr.close()
+    _, status, usage = os.wait4(proc.pid, 0)
+    wall = time.perf_counter() - start
+    proc.returncode = os.waitstatus_to_exitcode(status)
+    if proc.returncode != 0:
+        sys.exit("bench: %s failed under --engine=%s:\n%s" % (path, engine, err))
+    # the child's ru_maxrss counts this process's pages from before the
+    # exec, so the interpreter's own figure comes first
+    rss = re.search(r"rss: peak (\d+) KB", err)
+    alloc = re.search(r"gc: allocated (\d+) bytes", err)
+    return (wall, int(rss.group(1)) if rss else usage.ru_maxrss,
+            int(alloc.group(1)) if alloc else 0)
+
+
+def measure(run, engine, path, runs):
+    run_once(run, engine, path)
+    walls, rss, allocs = [], [], []
+    for _ in range(runs):
+        wall, peak, alloc = run_once(run, engine, path)
+        walls.append(wall * 1000)
+        rss.append(peak)
+        allocs.append(alloc)
+    return {
+        "time_ms": round(statistics.median(walls), 3),
+        "time_var": round(statistics.variance(walls), 3) if runs > 1 else 0.0,
+        "rss_kb": statistics.median(rss),
+        "alloc_bytes": statistics.median(allocs),
+    }
+
+
+def jobs_throughput(run, paths, rounds=4):
+    """Scripts per second with --jobs=N, for N from 1 to the CPU count."""
+    scripts = list(paths) * rounds
+    rows = []
+    jobs = 1
+    while True:
+        start = time.perf_counter()
+        proc = subprocess.run([run, "--jobs=%d" % jobs, "--no-cache",
+                               "--recursion-limit=10000"] + scripts,
+                              stdout=subprocess.DEVNULL, stderr=subprocess.PIPE)
+        wall = time.perf_counter() - start
+        if proc.returncode != 0:
+            sys.exit("bench: --jobs=%d failed:\n%s" % (jobs, proc.stderr.decode("utf-8", "replace")))
+        rows.append((jobs, len(scripts) / wall))
+        if jobs >= (os.cpu_count() or 1):
+            return rows
+        jobs = min(jobs * 2, os.cpu_count())
+
+
+def change(now, then):
+    if not then:
+        return ""
+    return "%+.1f%%" % (100.0 * (now - then) / then)
+
+
+def regressions(now, then, tolerance):
+    found = []
+    if now["time_ms"] > then["time_ms"] * (1 + tolerance):
+        found.append("time")
+    if now["rss_kb"] > then["rss_kb"] * (1 + RSS_TOLERANCE):
+        found.append("rss")
+    if now["alloc_bytes"] > then["alloc_bytes"] * (1 + ALLOC_TOLERANCE) + 4096:
+        found.append("alloc")
+    return found
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Runs the benchmark corpus.")
+    parser.add_argument("--runs", type=int, default=5)
+    parser.add_argument("--update", action="store_true",
+                        help="store the results as the new baseline")
+    parser.add_argument("--baseline", default=os.path.join(HERE, "baseline.json"))
+    parser.add_argument("--tolerance", type=float, default=0.25,
+                        help="allowed growth of the median time (default 0.25)")
+    parser.add_argument("--run", default=os.path.join(HERE, os.pardir, "run"))
+    parser.add_argument("--no-jobs", action="store_true",
+                        help="skip the --jobs throughput")
+    parser.add_argument("cases", nargs="*")
+    opts = parser.parse_args()
+
+    baseline = {}
+    if os.path.exists(opts.baseline):
+        with open(opts.baseline) as f:
+            baseline = json.load(f).get("cases", {})
+
+    gendir = tempfile.mkdtemp(prefix="mypy-bench-")
+    try:
+        cases = corpus(gendir)
+        unknown = [c for c in opts.cases if c not in cases]
+        if unknown:
+            sys.exit("bench: no case " + ", ".join(unknown))
+        results = {}
+        failed = []
+        print("%-20s %10s %10s %8s %10s %8s %12s %8s" %
+              ("case", "median ms", "var", "", "rss KB", "", "alloc", ""))
+        for name in opts.cases or sorted(cases):
+            for engine in ENGINES:
+                key = name + "/" + engine
+                now = measure(opts.run, engine, cases[name], opts.runs)
+                results[key] = now
+                then = baseline.get(key)
+                flags = regressions(now, then, opts.tolerance) if then else []
+                if flags:
+                    failed.append(key)
+                print("%-20s %10.1f %10.2f %8s %10d %8s %12d %8s%s" % (
+                    key, now["time_ms"], now["time_var"],
+                    change(now["time_ms"], then and then["time_ms"]),
+                    now["rss_kb"], change(now["rss_kb"], then and then["rss_kb"]),
+                    now["alloc_bytes"],
+                    change(now["alloc_bytes"], then and then["alloc_bytes"]),
+                    "  REGRESSED: " + ", ".join(flags) if flags else ""))
+                sys.stdout.flush()
+        if not opts.no_jobs:
+            rows = jobs_throughput(opts.run, [cases[name] for name in opts.cases or sorted(cases)])
+            print("%-20s %10s %10s" % ("jobs", "scripts/s", "speedup"))
+            for jobs, rate in rows:
+                print("%-20d %10.1f %9.2fx" % (jobs, rate, rate / rows[0][1]))
+    finally:
+        shutil.rmtree(gendir)
+
+    if opts.update:
+        baseline.update(results)
+        with open(opts.baseline, "w") as f:
+            json.dump({"runs": opts.runs, "cases": baseline}, f, indent=2, sort_keys=True)
+            f.write("\n")
+        print("bench: baseline written to " + opts.baseline)
+    elif failed:
+        print("bench: %d regressed against %s" % (len(failed), opts.baseline))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
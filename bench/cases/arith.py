@@ -0,0 +1,24 @@
+# long arithmetic expressions on ints, floats and longs
+def poly(x, n):
+    if n == 0:
+        return x
+    y = x * 3 + 7 - x * x + x * 2 - 5 + x * x * 2 - x * 4 + 1
+    z = y * 0.5 + x * 1.25 - y * 0.25 + 3.0 * x - 1.5
+    w = x * x % 97 + y // 7 - z / 3.0 + x ** 2 - y % 11
+    if z < y:
+        return poly(x + 1, n - 1) + w * 0
+    return poly(x - 1, n - 1) - w * 0
+
+def grow(x, n):
+    if n == 0:
+        return x
+    return grow(x * 3 + n, n - 1)
+
+def sweep(k):
+    if k == 0:
+        return 0
+    return poly(k, 600) + sweep(k - 1)
+
+print sweep(150)
+print grow(1, 400) % 1000000007
+print 2 ** 2000 % 1000000009
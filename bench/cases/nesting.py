@@ -0,0 +1,27 @@
+# nested functions reading enclosing scopes, and deeply nested ifs
+def outer(a):
+    def mid(b):
+        def inner(c):
+            if c > 0:
+                if c > 1:
+                    if c > 2:
+                        if c > 3:
+                            return a + b + c
+                        return a + b
+                    return a
+                return b
+            return c
+        return inner(b + 1) + inner(b - 1)
+    return mid(a) + mid(a + 1)
+
+def walk(n):
+    if n == 0:
+        return 0
+    return outer(n % 5) + walk(n - 1)
+
+def spin(k):
+    if k == 0:
+        return 0
+    return walk(800) + spin(k - 1)
+
+print spin(20)
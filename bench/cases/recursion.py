@@ -0,0 +1,21 @@
+# deep and wide recursion: call overhead dominates
+def fib(n):
+    if n < 2:
+        return n
+    return fib(n - 1) + fib(n - 2)
+
+def ack(m, n):
+    if m == 0:
+        return n + 1
+    if n == 0:
+        return ack(m - 1, 1)
+    return ack(m - 1, ack(m, n - 1))
+
+def count(n):
+    if n == 0:
+        return 0
+    return 1 + count(n - 1)
+
+print fib(24)
+print ack(2, 300)
+print count(900)
@@ -0,0 +1,113 @@
+//  Microbenchmark: the latency of running a small script through the
+//  library against starting ./run for it. In process, the script runs
+//  from source, parsed each time; as a Program, parsed once; and on a
+//  fresh Interpreter each time. Out of process, ./run is spawned on it,
+//  its output read back through a pipe, and waited for.
+//
+//  usage: embed_bench [calls] [path to run]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "../includes/mypy.h"
+
+extern char** environ;
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+const std::string script =
+  "def fib(n):\n"
+  "    if n < 2:\n"
+  "        return n\n"
+  "    return fib(n - 1) + fib(n - 2)\n"
+  "print fib(12)\n";
+const std::string expected = "144\n";
+
+// microseconds a call, the median and the mean
+void measure(const char* name, unsigned long calls, const std::function<std::string()>& call) {
+  std::vector<double> times;
+  for (unsigned long i = 0; i < calls; ++i) {
+    Clock::time_point start = Clock::now();
+    const std::string output = call();
+    std::chrono::duration<double, std::micro> elapsed = Clock::now() - start;
+    if (output != expected) {
+      std::cerr << "embed_bench: " << name << " printed \"" << output << "\"" << std::endl;
+      std::exit(1);
+    }
+    times.push_back(elapsed.count());
+  }
+  double total = 0;
+  for (double t : times) total += t;
+  std::sort(times.begin(), times.end());
+  std::cout << std::left << std::setw(24) << name << std::right << std::fixed
+            << std::setprecision(1) << std::setw(12) << times[times.size() / 2]
+            << std::setw(12) << total / times.size() << std::endl;
+}
+
+std::string spawn(const char* run, const char* file) {
+  int fds[2];
+  if (pipe(fds) != 0) return "";
+  posix_spawn_file_actions_t actions;
+  posix_spawn_file_actions_init(&actions);
+  posix_spawn_file_actions_adddup2(&actions, fds[1], STDOUT_FILENO);
+  posix_spawn_file_actions_addclose(&actions, fds[0]);
+  char* argv[] = { const_cast<char*>(run), const_cast<char*>("--no-cache"),
+                   const_cast<char*>(file), nullptr };
+  pid_t pid;
+  const int failed = posix_spawn(&pid, run, &actions, nullptr, argv, environ);
+  posix_spawn_file_actions_destroy(&actions);
+  close(fds[1]);
+  std::string output;
+  char buffer[4096];
+  for (ssize_t n; (n = read(fds[0], buffer, sizeof buffer)) > 0; ) {
+    output.append(buffer, n);
+  }
+  close(fds[0]);
+  int status;
+  if (failed || waitpid(pid, &status, 0) != pid || !WIFEXITED(status) || WEXITSTATUS(status)) {
+    return "";
+  }
+  return output;
+}
+
+}
+
+int main(int argc, char* argv[]) {
+  const unsigned long calls = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 500;
+  const char* run = argc > 2 ? argv[2] : "./run";
+  if (!calls) return 1;
+
+  std::cout << std::left << std::setw(24) << "us/call" << std::right
+            << std::setw(12) << "median" << std::setw(12) << "mean" << std::endl;
+  mypy::Interpreter python;
+  measure("library, source", calls, [&]() { return python.run(script).output; });
+  mypy::Program program;
+  python.compile(script, program);
+  measure("library, program", calls, [&]() { return python.run(program).output; });
+  measure("library, new instance", calls, [&]() {
+    mypy::Interpreter fresh;
+    return fresh.run(script).output;
+  });
+
+  char file[] = "/tmp/embed_benchXXXXXX";
+  const int fd = mkstemp(file);
+  if (fd < 0 || write(fd, script.data(), script.size()) != static_cast<ssize_t>(script.size())) {
+    std::cerr << "embed_bench: cannot write the script" << std::endl;
+    return 1;
+  }
+  close(fd);
+  measure("fork/exec ./run", calls, [&]() { return spawn(run, file); });
+  unlink(file);
+  return 0;
+}
@@ -0,0 +1,113 @@
+//  Microbenchmark: int arithmetic through Value::binary, whose kernels
+//  check for overflow into a long, against the unchecked kernels they
+//  replaced, dispatched through a table as Value::binary does. Then
+//  the cost of long multiplication and decimal printing as the operands
+//  grow. The objects are built with the interpreter's flags, so for
+//  fair numbers build everything optimised:
+//
+//    make clean && make CFLAGS="-std=c++11 -O2" int_bench
+//
+//  usage: int_bench [rounds]
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include "../includes/bigint.h"
+#include "../includes/value.h"
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+typedef Value (*BinaryFn)(const Value&, const Value&);
+
+// keeps the results from being optimised away
+volatile long sink;
+
+double nsPer(Clock::time_point start, unsigned long n) {
+  std::chrono::duration<double, std::nano> elapsed = Clock::now() - start;
+  return elapsed.count() / n;
+}
+
+// the kernels as they were before longs
+Value oldAdd(const Value& x, const Value& y) { return Value(x.getInt() + y.getInt()); }
+Value oldSub(const Value& x, const Value& y) { return Value(x.getInt() - y.getInt()); }
+Value oldMul(const Value& x, const Value& y) { return Value(x.getInt() * y.getInt()); }
+
+// Value::binary with the old kernels
+struct OldDispatch {
+  OldDispatch() : fn() {
+    for (int x = 0; x < Value::NUM_TYPES; ++x) {
+      for (int y = 0; y < Value::NUM_TYPES; ++y) {
+        fn[Value::ADD][x][y] = oldAdd;
+        fn[Value::SUB][x][y] = oldSub;
+        fn[Value::MUL][x][y] = oldMul;
+      }
+    }
+  }
+  BinaryFn fn[Value::NUM_OPS][Value::NUM_TYPES][Value::NUM_TYPES];
+};
+const OldDispatch oldDispatch;
+
+__attribute__((noinline)) Value oldBinary(Value::Op op, const Value& x, const Value& y) {
+  return oldDispatch.fn[op][x.getType()][y.getType()](x, y);
+}
+
+void smallInts(unsigned long rounds) {
+  const Value::Op ops[] = { Value::ADD, Value::SUB, Value::MUL };
+  const char* const names[] = { "+", "-", "*" };
+  for (int k = 0; k < 3; ++k) {
+    long sum = 0;
+    Clock::time_point start = Clock::now();
+    for (unsigned long i = 0; i < rounds; ++i) {
+      sum += oldBinary(ops[k], Value(static_cast<long>(i & 1023)), Value(7L)).getInt();
+    }
+    const double oldNs = nsPer(start, rounds);
+
+    start = Clock::now();
+    for (unsigned long i = 0; i < rounds; ++i) {
+      sum += Value::binary(ops[k], Value(static_cast<long>(i & 1023)), Value(7L)).getInt();
+    }
+    const double newNs = nsPer(start, rounds);
+    std::cout << std::setw(8) << names[k]
+              << std::setw(14) << std::fixed << std::setprecision(2) << oldNs
+              << std::setw(14) << newNs
+              << std::setw(10) << std::setprecision(2) << newNs / oldNs << "x" << std::endl;
+    sink = sum;
+  }
+}
+
+void longs(unsigned long rounds) {
+  for (unsigned long digits : {16UL, 64UL, 256UL, 1024UL, 4096UL}) {
+    // a number of about digits * 32 bits
+    BigInt x = BigInt(3L).pow(digits * 20);
+    BigInt y = x - BigInt(12345L);
+    const unsigned long n = rounds / (digits * digits / 16 + 1) + 1;
+    long total = 0;
+    Clock::time_point start = Clock::now();
+    for (unsigned long i = 0; i < n; ++i) {
+      total += (x * y).getDigits().size();
+    }
+    const double mulUs = nsPer(start, n) / 1000;
+    start = Clock::now();
+    total += x.toString().size();
+    const double strUs = nsPer(start, 1) / 1000;
+    std::cout << std::setw(8) << x.getDigits().size()
+              << std::setw(14) << std::fixed << std::setprecision(2) << mulUs
+              << std::setw(14) << strUs << std::endl;
+    sink = total;
+  }
+}
+
+}
+
+int main(int argc, char* argv[]) {
+  const unsigned long rounds = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 20000000;
+  std::cout << std::setw(8) << "op" << std::setw(14) << "unchecked ns"
+            << std::setw(14) << "checked ns" << std::setw(11) << "ratio" << std::endl;
+  smallInts(rounds);
+  std::cout << std::endl << std::setw(8) << "digits" << std::setw(14) << "mul us"
+            << std::setw(14) << "str us" << std::endl;
+  longs(rounds / 1000);
+  return 0;
+}
@@ -0,0 +1,95 @@
+//  Microbenchmark: operations on literals, the way the AST engine
+//  evaluates them (a BinaryNode over two Literal nodes) and straight
+//  through Value::binary, for each kind of value. The difference is the
+//  cost of walking the tree and of the type feedback on the node.
+//
+//  usage: literal_bench [rounds]
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include "../includes/ast.h"
+#include "../includes/gc.h"
+#include "../includes/literal.h"
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+// keeps the results from being optimised away
+volatile long sink;
+
+double nsPer(Clock::time_point start, unsigned long n) {
+  std::chrono::duration<double, std::nano> elapsed = Clock::now() - start;
+  return elapsed.count() / n;
+}
+
+struct Case {
+  const char* name;
+  const BinaryNode* node;
+  Value::Op op;
+  Value x;
+  Value y;
+};
+
+void run(const Case& c, unsigned long rounds) {
+  long total = 0;
+  Clock::time_point start = Clock::now();
+  for (unsigned long i = 0; i < rounds; ++i) {
+    total += c.node->eval().getType();
+  }
+  const double nodeNs = nsPer(start, rounds);
+
+  start = Clock::now();
+  for (unsigned long i = 0; i < rounds; ++i) {
+    total += Value::binary(c.op, c.x, c.y).getType();
+  }
+  const double valueNs = nsPer(start, rounds);
+  std::cout << std::left << std::setw(18) << c.name << std::right
+            << std::setw(12) << std::fixed << std::setprecision(2) << nodeNs
+            << std::setw(12) << valueNs << std::endl;
+  sink = total;
+}
+
+}
+
+int main(int argc, char* argv[]) {
+  const unsigned long rounds = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 5000000;
+  Heap& heap = Heap::getInstance();
+  const Value i(12345L), j(678L), f(3.25), g(0.5);
+  const Value s = Value::string(heap.constantString("spam", 4));
+  const Value t = Value::string(heap.constantString("eggs", 4));
+  Literal li(i), lj(j), lf(f), lg(g), ls(s), lt(t);
+
+  AddBinaryNode intAdd(&li, &lj);
+  MulBinaryNode intMul(&li, &lj);
+  ModBinaryNode intMod(&li, &lj);
+  AddBinaryNode floatAdd(&lf, &lg);
+  DivBinaryNode floatDiv(&lf, &lg);
+  AddBinaryNode mixedAdd(&li, &lf);
+  LessBinaryNode intLess(&li, &lj);
+  LessBinaryNode floatLess(&lf, &lg);
+  EqualBinaryNode strEqual(&ls, &lt);
+  AddBinaryNode strAdd(&ls, &lt);
+
+  const Case cases[] = {
+    { "int + int", &intAdd, Value::ADD, i, j },
+    { "int * int", &intMul, Value::MUL, i, j },
+    { "int % int", &intMod, Value::MOD, i, j },
+    { "float + float", &floatAdd, Value::ADD, f, g },
+    { "float / float", &floatDiv, Value::DIV, f, g },
+    { "int + float", &mixedAdd, Value::ADD, i, f },
+    { "int < int", &intLess, Value::LT, i, j },
+    { "float < float", &floatLess, Value::LT, f, g },
+    { "str == str", &strEqual, Value::EQ, s, t },
+    { "str + str", &strAdd, Value::ADD, s, t },
+  };
+  std::cout << std::left << std::setw(18) << "op" << std::right
+            << std::setw(12) << "node ns" << std::setw(12) << "value ns" << std::endl;
+  for (const Case& c : cases) {
+    // str + str allocates a new string every time
+    run(c, c.x.getType() == Value::STR && c.op == Value::ADD ? rounds / 10 : rounds);
+  }
+  return 0;
+}
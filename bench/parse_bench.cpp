@@ -0,0 +1,109 @@
+//  Microbenchmark: parse throughput across threads. Generates a corpus
+//  of sources, then parses all of it on 1, 2, 4, ... threads up to the
+//  number of CPUs. As with --jobs, each file is parsed on a thread of
+//  its own, with its own scanner, node pool and constants.
+//
+//  usage: parse_bench [files] [kilobytes per file]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../includes/ast.h"
+#include "../includes/constants.h"
+#include "../includes/parser.h"
+#include "../includes/source.h"
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+std::string source(unsigned long file, unsigned long bytes) {
+  std::string text;
+  for (unsigned long i = 0; text.size() < bytes; ++i) {
+    const std::string name = "f" + std::to_string(file) + "_" + std::to_string(i);
+    text += "def " + name + "(alpha, beta, gamma):\n";
+    text += "    if alpha < beta:\n";
+    text += "        return alpha * " + std::to_string(i) + " + beta // 3 - 2.5e3\n";
+    text += "    delta = 'a string ' + \"and another\"  # a comment\n";
+    text += "    return " + name + "(delta, gamma, 123456789012345678901234567890)\n";
+    text += "print " + name + "\n";
+  }
+  return text;
+}
+
+void parse(FILE* file) {
+  Source text;
+  if (!text.open(file)) {
+    std::cerr << "parse_bench: cannot read a source" << std::endl;
+    std::exit(1);
+  }
+  std::vector<Node*> stmts;
+  ParseContext context{PoolOfNodes::getInstance(), ConstantPool::getInstance(), stmts};
+  yyscan_t scanner = init_scanner(text);
+  const int status = yyparse(scanner, context);
+  end_scanner(scanner);
+  if (status != 0) {
+    std::cerr << "parse_bench: a source does not parse" << std::endl;
+    std::exit(1);
+  }
+}
+
+}
+
+int main(int argc, char* argv[]) {
+  const unsigned long count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 32;
+  const unsigned long kilobytes = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 512;
+  std::vector<FILE*> files;
+  unsigned long bytes = 0;
+  for (unsigned long i = 0; i < count; ++i) {
+    const std::string text = source(i, kilobytes << 10);
+    FILE* file = std::tmpfile();
+    if (!file || std::fwrite(text.data(), 1, text.size(), file) != text.size()
+        || std::fflush(file) != 0) {
+      std::cerr << "parse_bench: cannot write the sources" << std::endl;
+      return 1;
+    }
+    files.push_back(file);
+    bytes += text.size();
+  }
+
+  const unsigned long cpus = std::max(1u, std::thread::hardware_concurrency());
+  const double mb = bytes / 1048576.0;
+  double single = 0;
+  std::cout << std::left << std::setw(10) << "threads" << std::right
+            << std::setw(12) << "MB/s" << std::setw(12) << "speedup" << std::endl;
+  for (unsigned long threads = 1; ; threads = std::min(threads * 2, cpus)) {
+    std::atomic<unsigned long> next(0);
+    Clock::time_point start = Clock::now();
+    std::vector<std::thread> workers;
+    for (unsigned long t = 0; t < threads; ++t) {
+      workers.emplace_back([&]() {
+        for (unsigned long i = next++; i < files.size(); i = next++) {
+          // the constants point into the pool, so both go with the thread
+          std::thread(parse, files[i]).join();
+        }
+      });
+    }
+    for (std::thread& worker : workers) {
+      worker.join();
+    }
+    std::chrono::duration<double> elapsed = Clock::now() - start;
+    const double rate = mb / elapsed.count();
+    if (threads == 1) single = rate;
+    std::cout << std::left << std::setw(10) << threads << std::right << std::fixed
+              << std::setw(12) << std::setprecision(1) << rate
+              << std::setw(11) << std::setprecision(2) << rate / single << "x" << std::endl;
+    if (threads >= cpus) break;
+  }
+  for (FILE* file : files) {
+    std::fclose(file);
+  }
+  return 0;
+}
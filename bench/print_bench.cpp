@@ -0,0 +1,76 @@
+//  Microbenchmark: printing 10M numbers, as print does, to /dev/null or
+//  the file given. Each is written through the output buffer and the
+//  formatters of Writer, and, for comparison, the way print used to:
+//  through std::ostream, with std::endl flushing every line. Half the
+//  numbers are ints, half are floats, half of those whole.
+//
+//  usage: print_bench [numbers] [file]
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <fcntl.h>
+#include <unistd.h>
+#include "../includes/writer.h"
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+void measure(const char* name, unsigned long count, const std::function<void()>& print) {
+  Clock::time_point start = Clock::now();
+  print();
+  std::chrono::duration<double> elapsed = Clock::now() - start;
+  std::cout << std::left << std::setw(26) << name << std::right << std::fixed
+            << std::setprecision(2) << std::setw(10) << elapsed.count() << " s"
+            << std::setprecision(1) << std::setw(10) << count / elapsed.count() / 1e6
+            << " M/s" << std::endl;
+}
+
+double floatAt(unsigned long i) {
+  return i % 2 ? i * 0.25 : static_cast<double>(i);
+}
+
+}
+
+int main(int argc, char* argv[]) {
+  const unsigned long count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000000;
+  const char* file = argc > 2 ? argv[2] : "/dev/null";
+  const unsigned long half = count / 2;
+
+  const int fd = open(file, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    std::cerr << "print_bench: cannot open " << file << std::endl;
+    return 1;
+  }
+  measure("Writer", count, [&]() {
+    Writer out;
+    out.setSink(fd);
+    for (unsigned long i = 0; i < half; ++i) {
+      out.writeInt(i * 7919);
+      out.newline();
+      out.writeFloat(floatAt(i));
+      out.newline();
+    }
+    out.flush();
+  });
+  close(fd);
+
+  // what Value::str() did, to a stream flushed every line
+  std::ofstream stream(file);
+  measure("ostream, std::endl", count, [&]() {
+    for (unsigned long i = 0; i < half; ++i) {
+      stream << std::to_string(i * 7919) << std::endl;
+      char buf[32];
+      snprintf(buf, sizeof buf, "%.12g", floatAt(i));
+      std::string text(buf);
+      if (text.find_first_of(".en") == std::string::npos) text += ".0";
+      stream << text << std::endl;
+    }
+  });
+  return 0;
+}
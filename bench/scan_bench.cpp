@@ -0,0 +1,81 @@
+//  Microbenchmark: scanner throughput. Generates a source of about the
+//  given size from a mix of definitions, expressions, strings and
+//  numbers, then times loading it and yylex over all of it, the way the
+//  parser would pull tokens: once with the file read in, as from a
+//  pipe, and once with it mapped.
+//
+//  usage: scan_bench [megabytes]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include "../includes/ast.h"
+#include "../includes/parser.h"
+#include "../includes/source.h"
+#include "../parse.tab.h"
+
+extern int yylex(YYSTYPE*, YYLTYPE*, yyscan_t);
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+std::string source(unsigned long bytes) {
+  std::string text;
+  for (unsigned long i = 0; text.size() < bytes; ++i) {
+    text += "def function_" + std::to_string(i) + "(alpha, beta, gamma):\n";
+    text += "    if alpha < beta:\n";
+    text += "        return alpha * " + std::to_string(i) + " + beta // 3 - 2.5e3\n";
+    text += "    delta = 'a string ' + \"and another\"  # a comment\n";
+    text += "    return function_" + std::to_string(i / 2) + "(delta, gamma, 123456789012345678901234567890)\n";
+    text += "print function_" + std::to_string(i) + "(1, 2.0, 0x1f)\n";
+  }
+  return text;
+}
+
+void scan(FILE* file, bool map, unsigned long bytes) {
+  std::rewind(file);
+  Source text;
+  unsigned long tokens = 0;
+  Clock::time_point start = Clock::now();
+  if (!text.open(file, map)) {
+    std::cerr << "scan_bench: cannot read the source" << std::endl;
+    std::exit(1);
+  }
+  yyscan_t scanner = init_scanner(text);
+  YYSTYPE value;
+  YYLTYPE location;
+  while (yylex(&value, &location, scanner)) {
+    ++tokens;
+  }
+  std::chrono::duration<double> elapsed = Clock::now() - start;
+  end_scanner(scanner);
+
+  const double mb = bytes / 1048576.0;
+  std::cout << std::fixed << std::setprecision(1)
+            << "scan (" << (text.isMapped() ? "mmap" : "read") << "): "
+            << mb << " MB, " << tokens << " tokens in "
+            << std::setprecision(3) << elapsed.count() << " s: "
+            << std::setprecision(1) << mb / elapsed.count() << " MB/s, "
+            << tokens / elapsed.count() / 1e6 << " M tokens/s" << std::endl;
+}
+
+}
+
+int main(int argc, char* argv[]) {
+  const unsigned long megabytes = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 16;
+  const std::string text = source(megabytes << 20);
+  FILE* file = std::tmpfile();
+  if (!file || std::fwrite(text.data(), 1, text.size(), file) != text.size()
+      || std::fflush(file) != 0) {
+    std::cerr << "scan_bench: cannot write the source" << std::endl;
+    return 1;
+  }
+  scan(file, false, text.size());
+  scan(file, true, text.size());
+  std::fclose(file);
+  return 0;
+}
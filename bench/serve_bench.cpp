@@ -0,0 +1,106 @@
+//  Load generator for ./run --serve. Starts a server on a socket of its
+//  own, then keeps 1, 2, 4, ... clients, up to twice the number of
+//  CPUs, sending a small script as fast as the answers come. For each
+//  number of clients it reports requests a second and the p50 and p99
+//  latency of a request, connection included.
+//
+//  usage: serve_bench [requests per level] [path to run]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "../includes/server.h"
+
+extern char** environ;
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+const std::string script =
+  "def fib(n):\n"
+  "    if n < 2:\n"
+  "        return n\n"
+  "    return fib(n - 1) + fib(n - 2)\n"
+  "print fib(12)\n";
+const std::string expected = "144\n";
+
+}
+
+int main(int argc, char* argv[]) {
+  const unsigned long requests = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 2000;
+  const char* run = argc > 2 ? argv[2] : "./run";
+  if (!requests) return 1;
+  const unsigned long cpus = std::max(1u, std::thread::hardware_concurrency());
+  const std::string socket = "/tmp/serve_bench." + std::to_string(getpid()) + ".sock";
+  const std::string jobs = "--jobs=" + std::to_string(cpus);
+
+  char* args[] = { const_cast<char*>(run), const_cast<char*>("--serve"),
+                   const_cast<char*>(socket.c_str()), const_cast<char*>(jobs.c_str()), nullptr };
+  pid_t server;
+  if (posix_spawn(&server, run, nullptr, nullptr, args, environ) != 0) {
+    std::cerr << "serve_bench: cannot start " << run << std::endl;
+    return 1;
+  }
+  // until the server answers
+  std::ostringstream none;
+  for (int tries = 0; Server::request(socket, Server::TEXT, "", none, none) != EXIT_SUCCESS; ++tries) {
+    if (tries == 500) {
+      std::cerr << "serve_bench: no server on " << socket << std::endl;
+      kill(server, SIGTERM);
+      return 1;
+    }
+    usleep(10000);
+  }
+
+  int status = 0;
+  std::cout << std::left << std::setw(10) << "clients" << std::right << std::setw(12) << "req/s"
+            << std::setw(12) << "p50 us" << std::setw(12) << "p99 us" << std::endl;
+  for (unsigned long clients = 1; clients <= 2 * cpus; clients *= 2) {
+    std::vector<double> latencies(requests);
+    std::atomic<unsigned long> next(0);
+    std::atomic<bool> wrong(false);
+    Clock::time_point start = Clock::now();
+    std::vector<std::thread> threads;
+    for (unsigned long c = 0; c < clients; ++c) {
+      threads.emplace_back([&]() {
+        for (unsigned long i = next++; i < requests; i = next++) {
+          std::ostringstream out, err;
+          Clock::time_point sent = Clock::now();
+          const int result = Server::request(socket, Server::TEXT, script, out, err);
+          std::chrono::duration<double, std::micro> elapsed = Clock::now() - sent;
+          latencies[i] = elapsed.count();
+          if (result != EXIT_SUCCESS || out.str() != expected) wrong = true;
+        }
+      });
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+    std::chrono::duration<double> elapsed = Clock::now() - start;
+    if (wrong) {
+      std::cerr << "serve_bench: a request was answered wrongly" << std::endl;
+      status = 1;
+      break;
+    }
+    std::sort(latencies.begin(), latencies.end());
+    std::cout << std::left << std::setw(10) << clients << std::right << std::fixed
+              << std::setprecision(0) << std::setw(12) << requests / elapsed.count()
+              << std::setprecision(1) << std::setw(12) << latencies[requests / 2]
+              << std::setw(12) << latencies[requests * 99 / 100] << std::endl;
+  }
+  kill(server, SIGTERM);
+  waitpid(server, nullptr, 0);
+  return status;
+}
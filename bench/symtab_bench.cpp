@@ -0,0 +1,90 @@
+//  Microbenchmark: name lookup in the atom-keyed SymbolTable against the
+//  std::map<std::string, ...> tables it replaced. Each round looks up
+//  every name of a scope once, the way a body of code would, with the
+//  old find-then-get pair and the new single lookup.
+//
+//  usage: symtab_bench [rounds]
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+#include "../includes/symbolTable.h"
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+// keeps the lookups from being optimised away
+volatile long sink;
+
+double nsPerLookup(Clock::time_point start, unsigned long lookups) {
+  std::chrono::duration<double, std::nano> elapsed = Clock::now() - start;
+  return elapsed.count() / lookups;
+}
+
+// the scope layout of the old SymbolTable
+struct MapTable {
+  MapTable() : functions(), symbols() {}
+  std::map<std::string, const FuncNode*> functions;
+  std::map<std::string, Value> symbols;
+};
+
+void run(unsigned long names, unsigned long rounds) {
+  std::vector<std::string> spellings;
+  std::vector<const Atom*> atoms;
+  for (unsigned long i = 0; i < names; ++i) {
+    spellings.push_back("name_" + std::to_string(i * 7919 % 100003));
+    atoms.push_back(Interner::getInstance().intern(spellings.back()));
+  }
+
+  MapTable maps;
+  SymbolTable table;
+  for (unsigned long i = 0; i < names; ++i) {
+    maps.symbols[spellings[i]] = Value(static_cast<long>(i));
+    table.setValue(atoms[i], Value(static_cast<long>(i)));
+  }
+
+  long sum = 0;
+  Clock::time_point start = Clock::now();
+  for (unsigned long r = 0; r < rounds; ++r) {
+    for (unsigned long i = 0; i < names; ++i) {
+      // the old IdentNode copied its name, then probed twice
+      const std::string name = spellings[i];
+      if (maps.symbols.find(name) != maps.symbols.end()) {
+        sum += maps.symbols.find(name)->second.getInt();
+      }
+    }
+  }
+  const double mapNs = nsPerLookup(start, rounds * names);
+
+  start = Clock::now();
+  for (unsigned long r = 0; r < rounds; ++r) {
+    for (unsigned long i = 0; i < names; ++i) {
+      const SymbolTable::Entry* entry = table.lookup(atoms[i]);
+      if (entry) sum += entry->value.getInt();
+    }
+  }
+  const double atomNs = nsPerLookup(start, rounds * names);
+
+  std::cout << std::setw(8) << names
+            << std::setw(14) << std::fixed << std::setprecision(2) << mapNs
+            << std::setw(14) << atomNs
+            << std::setw(10) << std::setprecision(1) << mapNs / atomNs << "x" << std::endl;
+  sink = sum;
+}
+
+}
+
+int main(int argc, char* argv[]) {
+  const unsigned long rounds = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200000;
+  std::cout << std::setw(8) << "names" << std::setw(14) << "map ns"
+            << std::setw(14) << "atom ns" << std::setw(11) << "speedup" << std::endl;
+  for (unsigned long names : {4UL, 16UL, 64UL, 256UL}) {
+    run(names, rounds * 16 / names);
+  }
+  return 0;
+}
@@ -0,0 +1,39 @@
+big = 9223372036854775807
+print big + 1
+print -big - 2
+print big * big
+x = 2 ** 64
+print x - x
+print x // 3
+print -x % 7
+print x > big
+print x == 18446744073709551616
+print x * 0.5
+print ~x
+n = 123456789012345678901234567890
+print n * n * n // 987654321987654321
+print n % -12345678901
+print 7 ** 2 ** 5
+print 10L
+def fact(n):
+    if n < 2:
+        return 1
+    return n * fact(n - 1)
+print fact(60)
+print fact(120) // fact(118)
+m = -big - 1
+print m // -1
+print -m
+print 10 ** 30 == 1e30
+print 10 ** 30 < 1e30
+y = 10 ** 400
+print y > 1.0
+print -y < -1e308
+inf = 1e308 * 10
+print y < inf
+print y == inf - inf
+print 2 ** 63 - 1 < 2.0 ** 63
+print x + 1 > 2.0 ** 64
+v = 2 ** 95 + 2 ** 42 + 1
+print v * 1.0 == 2 ** 95 * 1.0
+print v * 1.0 - 2 ** 95
@@ -0,0 +1,20 @@
+x = 2 + 3 * 4
+print x
+print -2 ** 10
+print 2 ** -1
+print "ab" * 3 + "c"
+print 7 // 2 < 4
+x += 1 + 1
+print x
+def f(n):
+    return n * 3 - 2 + 0 * 5
+print f(x)
+print 5 // 2 * 1 + 0
+print 2.5 * 1
+print True * 1
+print x * 1 + 0
+print 7 % -3
+print -7.5 // 2
+def never():
+    return 1 / 0
+print 1
@@ -0,0 +1,3 @@
+print "ab" * 2
+print 3 * True
+print 3 * None
@@ -0,0 +1,3 @@
+x = 10 ** 30
+print x * 2
+print x * None
@@ -0,0 +1,2 @@
+print 2 * "ab"
+print None * 3
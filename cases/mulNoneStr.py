@@ -0,0 +1,2 @@
+print "ab" * 0
+print None * "ab"
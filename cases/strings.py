@@ -0,0 +1,44 @@
+def rep(s, n):
+    if n == 0:
+        return ""
+    return s + rep(s, n - 1)
+
+def build(n):
+    if n == 0:
+        return "x"
+    a = build(n - 1)
+    b = "<" + a + ">"
+    return b
+
+def churn(n):
+    if n == 0:
+        return 0
+    t = "abc" * 10
+    t = t + str2(n)
+    return churn(n - 1) + 1
+
+def str2(n):
+    return "n"
+
+print rep("ab", 5)
+print build(20)
+print churn(500)
+print "a" < "b"
+print "b" < "a"
+print "ab" == "ab"
+print "a" == 1
+print 1 < "a"
+print None < "a"
+print 'it''s' "\tq\x41\101\\"
+print r"raw\n"
+print "ab" * 3
+print 3 * "xy"
+print "z" * 0
+print "q" * -1
+x = "hello"
+y = x + " world"
+print y
+if "":
+    print "empty true"
+else:
+    print "empty false"
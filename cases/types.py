@@ -0,0 +1,48 @@
+def add(a, b):
+    return a + b
+def cmp(a, b):
+    if a < b:
+        return 1
+    if a <= b:
+        return 2
+    if a == b:
+        return 3
+    if a >= b:
+        return 4
+    if a > b:
+        return 5
+    return 6
+print add(1, 2)
+print add(1.5, 2.25)
+print add(4611686018427387904, 4611686018427387904)
+print add(2, 2.5)
+print add("a", "b")
+def warm(i):
+    if i == 0:
+        return 0
+    add(i, i)
+    add(1.0 * i, 2)
+    return warm(i - 1)
+warm(30)
+big = 1e308 * 10
+nan = big - big
+print cmp(1, 2)
+print cmp(2, 2)
+print cmp(3, 2)
+print cmp(1.0, 2.0)
+print cmp(2.0, 2.0)
+print cmp(3.0, 2.0)
+print cmp(nan, 1.0)
+print cmp(1.0, nan)
+print cmp(1, 2.0)
+print cmp(True, 1)
+def mul(a, b):
+    return a * b - b
+print mul(3037000500, 3037000500)
+print mul(-7, 3)
+print mul(2.5, 4.0)
+def deep(n):
+    if n == 0:
+        return 0
+    return 1 + deep(n - 1)
+print deep(900)
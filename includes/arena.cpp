@@ -0,0 +1,93 @@
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include "arena.h"
+
+Arena::Arena(const char* n, unsigned long size) :
+  name(n), chunkSize(size), chunks(), current(0), cleanups(),
+  inUse(0), peak(0), total(0) {
+}
+
+Arena::~Arena() {
+  reset();
+  for (Chunk& chunk : chunks) {
+    std::free(chunk.mem);
+  }
+}
+
+void* Arena::allocate(unsigned long bytes, unsigned long align) {
+  if (!chunks.empty()) {
+    Chunk& chunk = chunks[current];
+    unsigned long start = (chunk.used + align - 1) & ~(align - 1);
+    if (start + bytes <= chunk.size) {
+      inUse += start + bytes - chunk.used;
+      total += bytes;
+      if (inUse > peak) peak = inUse;
+      chunk.used = start + bytes;
+      return chunk.mem + start;
+    }
+    // leave the rest of this chunk unused and move on
+    inUse += chunk.size - chunk.used;
+    chunk.used = chunk.size;
+  }
+
+  // reuse the next empty chunk if it is big enough, otherwise insert a new one
+  unsigned long next = chunks.empty() ? 0 : current + 1;
+  if (next >= chunks.size() || chunks[next].size < bytes + align) {
+    unsigned long size = bytes + align > chunkSize ? bytes + align : chunkSize;
+    char* mem = static_cast<char*>(std::malloc(size));
+    if (!mem) throw std::bad_alloc();
+    chunks.insert(chunks.begin() + next, Chunk{mem, size, 0});
+  }
+  current = next;
+  return allocate(bytes, align);
+}
+
+Arena::Mark Arena::mark() const {
+  return Mark{current, chunks.empty() ? 0 : chunks[current].used, inUse, cleanups.size()};
+}
+
+void Arena::release(const Mark& m) {
+  runCleanups(m.cleanups);
+  if (chunks.empty()) return;
+  for (unsigned long i = m.chunk + 1; i <= current; ++i) {
+    chunks[i].used = 0;
+  }
+  current = m.chunk;
+  chunks[current].used = m.used;
+  inUse = m.inUse;
+}
+
+void Arena::reset() {
+  release(Mark{0, 0, 0, 0});
+}
+
+void Arena::runCleanups(unsigned long downTo) {
+  while (cleanups.size() > downTo) {
+    Cleanup c = cleanups.back();
+    cleanups.pop_back();
+    c.fn(c.obj);
+  }
+}
+
+unsigned long Arena::reservedBytes() const {
+  unsigned long res = 0;
+  for (const Chunk& chunk : chunks) {
+    res += chunk.size;
+  }
+  return res;
+}
+
+void Arena::printStats(std::ostream& out) const {
+  out << std::left << std::setw(10) << name << std::right
+      << std::setw(12) << inUse
+      << std::setw(12) << peak
+      << std::setw(14) << total
+      << std::setw(12) << reservedBytes()
+      << std::setw(8) << chunks.size() << std::endl;
+}
+
+Arena& Scratch::getInstance() {
+  static thread_local Arena scratch("scratch", 16 * 1024);
+  return scratch;
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+//  Bump-pointer region allocator. Objects are carved out of large
+//  chunks and given back all at once, by rolling the region back to
+//  a mark or resetting it, never one at a time.
+
+#include <cstddef>
+#include <iosfwd>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+class Arena {
+public:
+  // a position in the region that release() rolls back to
+  struct Mark {
+    unsigned long chunk;
+    unsigned long used;
+    unsigned long inUse;
+    unsigned long cleanups;
+  };
+
+  explicit Arena(const char* n, unsigned long chunkSize = 64 * 1024);
+  ~Arena();
+
+  void* allocate(unsigned long bytes, unsigned long align = alignof(std::max_align_t));
+
+  // construct a T in the region; its destructor runs when the region
+  // is rolled back past it
+  template <class T, class... Args>
+  T* make(Args&&... args) {
+    T* obj = new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    if (!std::is_trivially_destructible<T>::value) {
+      cleanups.push_back(Cleanup{&destroy<T>, obj});
+    }
+    return obj;
+  }
+
+  // uninitialised storage for n trivially destructible Ts
+  template <class T>
+  T* makeArray(unsigned long n) {
+    static_assert(std::is_trivially_destructible<T>::value, "arena arrays are never destroyed");
+    return static_cast<T*>(allocate(n * sizeof(T), alignof(T)));
+  }
+
+  Mark mark() const;
+  void release(const Mark&);
+  void reset();
+
+  const char* getName() const { return name; }
+  unsigned long bytesInUse() const { return inUse; }
+  unsigned long peakBytes() const { return peak; }
+  unsigned long totalBytes() const { return total; }
+  unsigned long reservedBytes() const;
+  void printStats(std::ostream&) const;
+
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+
+private:
+  struct Chunk {
+    char* mem;
+    unsigned long size;
+    unsigned long used;
+  };
+  struct Cleanup {
+    void (*fn)(void*);
+    void* obj;
+  };
+
+  template <class T>
+  static void destroy(void* obj) { static_cast<T*>(obj)->~T(); }
+  void runCleanups(unsigned long downTo);
+
+  const char* name;
+  const unsigned long chunkSize;
+  // chunks past `current` are empty and kept for reuse
+  std::vector<Chunk> chunks;
+  unsigned long current;
+  std::vector<Cleanup> cleanups;
+
+  unsigned long inUse;  // bytes handed out and not yet released
+  unsigned long peak;   // high-water mark of inUse
+  unsigned long total;  // bytes handed out over the region's lifetime
+};
+
+// Rolls an arena back to where it was when the scope was entered.
+class ArenaScope {
+public:
+  explicit ArenaScope(Arena& a) : arena(a), start(a.mark()) {}
+  ~ArenaScope() { arena.release(start); }
+  ArenaScope(const ArenaScope&) = delete;
+  ArenaScope& operator=(const ArenaScope&) = delete;
+private:
+  Arena& arena;
+  const Arena::Mark start;
+};
+
+// Region for evaluation temporaries. Each top-level statement and each
+// call runs inside an ArenaScope on it, so temporaries are dropped
+// wholesale when the statement or call completes. Values that outlive
+// them are copied into a SymbolTable.
+class Scratch {
+public:
+  static Arena& getInstance();
+private:
+  Scratch();
+};
@@ -4,286 +4,257 @@
 #include <cmath>
 #include <cstdlib>
 #include <iomanip>
+#include <algorithm>
+#include "arena.h"
 #include "ast.h"
+#include "gc.h"
+#include "interpreter.h"
+#include "memo.h"
+#include "profiler.h"
 
-const Literal* IdentNode::eval() const {
-  const Literal* val = TableManager::getInstance().getValue(ident);
-  if (!val) {
-    throw std::string("UnboundLocalError: local variable ") + ident + std::string(" referenced before assignment");
+Value IdentNode::eval() const {
+  TableManager& tm = TableManager::getInstance();
+  const Value* val;
+  switch (loc.kind) {
+    case Location::LOCAL: val = &tm.getLocal(loc.slot); break;
+    case Location::ENCLOSING: val = &tm.getEnclosing(loc.depth, loc.slot); break;
+    case Location::GLOBAL: val = &tm.getGlobal(loc.slot); break;
+    default: throw std::string("SystemError: unresolved name ") + ident->str();
+  }
+  if (val->isUndefined()) {
+    unbound(ident->str(), loc);
+  }
+  return *val;
+}
+
+// assignment always binds a local, or a global at module level
+void IdentNode::store(const Value& val) const {
+  if (loc.kind == Location::LOCAL) {
+    TableManager::getInstance().setLocal(loc.slot, val);
+  } else {
+    TableManager::getInstance().setGlobal(loc.slot, val);
+  }
+}
+
+void IdentNode::unbound(const std::string& name, const Location& loc) {
+  switch (loc.kind) {
+    case Location::LOCAL:
+      throw std::string("UnboundLocalError: local variable ") + name + std::string(" referenced before assignment");
+    case Location::ENCLOSING:
+      throw std::string("NameError: free variable ") + name + std::string(" referenced before assignment in enclosing scope");
+    default:
+      throw std::string("NameError: name ") + name + std::string(" is not defined");
   }
-  return val;
 }
 
-const Literal* PrintNode::eval() const {
+Value PrintNode::eval() const {
   // NEWLINE
   if (!node) {
-    std::cout << std::endl;
+    Interpreter::getInstance().getWriter().newline();
+    return Value();
   }
 
-  const Literal* res = node->eval();
-  if (!res) {
-    throw std::string("print node eval is null");
-  }
-  res->print();
+  node->eval().print();
+  return Value();
+}
 
-  return nullptr;
+Value IfNode::eval() const {
+  execute();
+  return Value();
 }
 
-const Literal* IfNode::eval() const {
+Completion IfNode::execute() const {
   if (!comparison) {
     throw std::string("comparison is null");
   }
-  if (!comparison->eval()) {
-    throw std::string("comparison cannot evaluate");
-  }
-
-  if (comparison->eval()->boolValue()) {
-    return ifBranch->eval();
-  } else {
-    return elseBranch->eval();
+  if (comparison->eval().boolValue()) {
+    return ifBranch->execute();
+  } else if (elseBranch) {
+    return elseBranch->execute();
   }
+  return Completion::normal();
 }
 
-// precook for eval
-// rule:
-//    if there are AsgBinaryNodes, mark identifier(lval) as nullptr.
-//    for TableManager, it can find a ident for current scope, while its value is nullptr
-//    handle nullptr in IdentNode->eval()
-void SuiteNode::preeval() const {
-    if (stmts.empty()) return;
-
-    for (Node* stmt : stmts) {
-      if (!stmt) continue;
-
-      const AsgBinaryNode* asg = dynamic_cast<AsgBinaryNode*>(stmt);
-      if (asg) {
-        std::string ident = asg->getIdent();
-        TableManager::getInstance().setValue(ident, nullptr);
-      }
-    }
+Value SuiteNode::eval() const {
+  execute();
+  return Value();
 }
-const Literal* SuiteNode::eval() const {
-  if (stmts.empty()) {
-    return nullptr;
-  }
-
-  // call preeval here to make sure the scope is correct
-  preeval();
 
+Completion SuiteNode::execute() const {
+  Profiler& profiler = Profiler::getInstance();
   for (Node* stmt : stmts) {
     if (!stmt) continue;
-    stmt->eval();
-    if (TableManager::getInstance().needReturnValue())
-      break;
+    if (profiler.isEnabled()) profiler.statement(stmt);
+    const Completion done = stmt->execute();
+    if (done.isAbrupt()) return done;
   }
-
-  return nullptr;
+  return Completion::normal();
 }
 void SuiteNode::append(Node* n) {
   stmts.push_back(n);
 }
 
-const Literal* FuncNode::eval() const {
-  TableManager::getInstance().setFunc(name, suite);
-  if (params) {
-    TableManager::getInstance().setParams(name, params);
-  }
-  return nullptr;
+Value FuncNode::eval() const {
+  TableManager::getInstance().setFunc(name, this);
+  return Value();
+}
+
+const std::vector<Node*>& FuncNode::getParams() const {
+  static const std::vector<Node*> none;
+  return params ? static_cast<ParamNode*>(params)->getParams() : none;
 }
 
 void ParamNode::append(Node* param) {
   params.push_back(param);
 }
-const std::vector<Node*> ParamNode::getParams() {
-  return params;
-}
-const Literal* ParamNode::eval() const {
-  return nullptr;
+Value ParamNode::eval() const {
+  return Value();
 }
 // for debug
 void ParamNode::print() const {
   std::cout << params.size() << " params: " << std::endl;
   for (const Node* n : params) {
-    n->eval()->print();
+    n->eval().print();
+  }
+}
+
+void CallNode::checkArguments(const std::string& funcName, unsigned long expected, unsigned long given) {
+  // TODO: support *args, **kwwargs
+  if (expected != given) {
+    throw std::string("TypeError:") + funcName + std::string("() takes exactly ")
+        + std::to_string(expected) + std::string(" arguments") + std::string("(") + std::to_string(given) + std::string(" given)");
   }
 }
 
-const Literal* CallNode::eval() const {
+Value CallNode::eval() const {
   TableManager& tm = TableManager::getInstance();
-  const Literal* res = new NoneLiteral();
-  const Node* func = tm.getFunc(funcName);
-
-  // if function has parameters, handle parameters firstly.
-  if (tm.findParams(funcName)) {
-    Node* paramsNode = tm.getParams(funcName);
-    const std::vector<Node*> params = static_cast<ParamNode*>(paramsNode)->getParams();
-    const std::vector<Node*> args = static_cast<ParamNode*>(arguments)->getParams();
-    // check whether arguments is valid
-    // TODO: support *args, **kwwargs
-    if (params.size() != args.size()) {
-      throw std::string("TypeError:") + funcName + std::string("() takes exactly ")
-          + std::to_string(params.size()) + std::string(" arguments") + std::string("(") + std::to_string(args.size()) + std::string(" given)");
-    }
+  SymbolTable* scope = nullptr;
+  const FuncNode* func = tm.getFunc(funcName, &scope, cache);
+  const std::vector<Node*>& args = static_cast<ParamNode*>(arguments)->getParams();
+  checkArguments(funcName->str(), func->getParams().size(), args.size());
+
+  // evaluate args in the caller's scope, before the callee's is pushed;
+  // they only live until the call returns, so they go in scratch space
+  Arena& scratch = Scratch::getInstance();
+  ArenaScope callScope(scratch);
+  Value* vals = scratch.makeArray<Value>(args.size());
+  std::fill(vals, vals + args.size(), Value());
+  Root keep(vals, args.size());
+  for (unsigned long i = 0; i < args.size(); ++i) {
+    vals[i] = args[i]->eval();
+  }
 
-    tm.pushScope();
-    // evaluate args
+  Memo& memo = Memo::getInstance();
+  const bool memoized = memo.applies(func, vals, args.size());
+  Value res;
+  if (memoized && memo.find(func, vals, args.size(), res)) {
+    return res;
+  }
+
+  Profiler& profiler = Profiler::getInstance();
+  Completion done = Completion::normal();
+  {
+    // the callee's frame goes at the end of the call, or with an error
+    ScopeGuard frame(tm);
+    ProfileGuard profiled(profiler);
+    if (profiler.isEnabled()) profiler.enter(func);
+    // parameters take the first slots of the frame
+    tm.pushScope(scope, func->getFrameSize());
     for (unsigned long i = 0; i < args.size(); ++i) {
-      const std::string param = static_cast<IdentNode*>(params[i])->getIdent();
-      const Literal* val = args[i]->eval();
-      tm.setValue(param, val);
+      tm.setLocal(i, vals[i]);
     }
-  }
+    Heap::getInstance().safepoint();
 
-  // already push scope above
-  if (!tm.findParams(funcName)) {
-    tm.pushScope();
+    // falling off the end completes normally, with None
+    done = func->getSuite()->execute();
   }
 
-  func->eval();
-  if (tm.needReturnValue()) {
-    res =tm.getReturnValue();
-  }
-  tm.popScope();
-  tm.setValue(funcName, res);
+  if (memoized) memo.store(func, vals, args.size(), done.value);
+  return done.value;
+}
 
-  return res;
+Value ReturnNode::eval() const {
+  return execute().value;
 }
 
-const Literal* ReturnNode::eval() const {
-  const Literal* res;
-  if (!testlist) {
-    res = new NoneLiteral();
-  } else {
-    res = testlist->eval();
-  }
-  TableManager::getInstance().setReturnValue(res);
-  return nullptr;
+Completion ReturnNode::execute() const {
+  return Completion::returning(testlist ? testlist->eval() : Value());
 }
 
-const Literal* UnaryNode::eval() const {
-  const Literal* absVal = node->eval();
-  return absVal->unopVal(op);
+Value UnaryNode::eval() const {
+  return node->eval().unary(op);
 }
 
-const Literal* AsgBinaryNode::eval() const {
+Value AsgBinaryNode::eval() const {
   if (!left || !right) {
     throw std::string("Error: left or right of BinaryNode is null");
   }
-  const Literal* res = right->eval();
-  const std::string n = getIdent();
-  TableManager::getInstance().setValue(n, res);
+  Value res = right->eval();
+  static_cast<IdentNode*>(left)->store(res);
   return res;
 }
-const std::string AsgBinaryNode::getIdent() const {
+const std::string& AsgBinaryNode::getIdent() const {
   return static_cast<IdentNode*>(left)->getIdent();
 }
+const Atom* AsgBinaryNode::getAtom() const {
+  return static_cast<IdentNode*>(left)->getAtom();
+}
 
-const Literal* AddBinaryNode::eval() const {
+template <Value::Op OP>
+Value BinaryNode::evalOperands() const {
   if (!left || !right) {
     throw std::string("Error: left or right of BinaryNode is null");
   }
-  const Literal* x = left->eval();
-  const Literal* y = right->eval();
-  //return (*x+*y);
-  return (*x).operator+(*y);
+  Value x = left->eval();
+  Root keep(x);
+  Value y = right->eval();
+  return feedback.apply<OP>(x, y, this);
 }
 
-const Literal* SubBinaryNode::eval() const {
-  if (!left || !right) {
-    throw std::string("Error: left or right of BinaryNode is null");
-  }
-  const Literal* x = left->eval();
-  const Literal* y = right->eval();
-  return ((*x)-(*y));
+Value AddBinaryNode::eval() const {
+  return evalOperands<Value::ADD>();
 }
 
-const Literal* MulBinaryNode::eval() const {
-  if (!left || !right) {
-    throw std::string("Error: left or right of BinaryNode is null");
-  }
-  const Literal* x = left->eval();
-  const Literal* y = right->eval();
-  return ((*x)*(*y));
+Value SubBinaryNode::eval() const {
+  return evalOperands<Value::SUB>();
 }
 
-const Literal* DivBinaryNode::eval() const {
-  if (!left || !right) {
-    throw std::string("Error: left or right of BinaryNode is null");
-  }
-  const Literal* x = left->eval();
-  const Literal* y = right->eval();
-  return ((*x)/(*y));
+Value MulBinaryNode::eval() const {
+  return evalOperands<Value::MUL>();
 }
 
-const Literal* IntDivBinaryNode::eval() const {
-  if (!left || !right) {
-    throw std::string("Error: left or right of BinaryNode is null");
-  }
-  const Literal* x = left->eval();
-  const Literal* y = right->eval();
-  return (*x).intDiv(*y);
+Value DivBinaryNode::eval() const {
+  return evalOperands<Value::DIV>();
 }
 
-const Literal* ModBinaryNode::eval() const {
-  if (!left || !right) {
-    throw std::string("Error: left or right of BinaryNode is null");
-  }
-  const Literal* x = left->eval();
-  const Literal* y = right->eval();
-  return ((*x) % (*y));
+Value IntDivBinaryNode::eval() const {
+  return evalOperands<Value::INT_DIV>();
 }
 
-const Literal* ExpBinaryNode::eval() const {
-  if (!left || !right) {
-    throw std::string("Error: left or right of BinaryNode is null");
-  }
-  const Literal* x = left->eval();
-  const Literal* y = right->eval();
-  return (*x) ^ (*y);
+Value ModBinaryNode::eval() const {
+  return evalOperands<Value::MOD>();
 }
 
+Value ExpBinaryNode::eval() const {
+  return evalOperands<Value::POW>();
+}
 
-const Literal* LessBinaryNode::eval() const {
-  if (!left || !right) {
-    throw std::string("Error: left or right of BinaryNode is null");
-  }
-  const Literal* x = left->eval();
-  const Literal* y = right->eval();
-  return (*x) < (*y);
+Value LessBinaryNode::eval() const {
+  return evalOperands<Value::LT>();
 }
 
-const Literal* GreaterBinaryNode::eval() const {
-  if (!left || !right) {
-    throw std::string("Error: left or right of BinaryNode is null");
-  }
-  const Literal* x = left->eval();
-  const Literal* y = right->eval();
-  return (*x) > (*y);
+Value GreaterBinaryNode::eval() const {
+  return evalOperands<Value::GT>();
 }
 
-const Literal* EqualBinaryNode::eval() const {
-  if (!left || !right) {
-    throw std::string("Error: left or right of BinaryNode is null");
-  }
-  const Literal* x = left->eval();
-  const Literal* y = right->eval();
-  return (*x) == (*y);
+Value EqualBinaryNode::eval() const {
+  return evalOperands<Value::EQ>();
 }
 
-const Literal* GrtEqBinaryNode::eval() const {
-  if (!left || !right) {
-    throw std::string("Error: left or right of BinaryNode is null");
-  }
-  const Literal* x = left->eval();
-  const Literal* y = right->eval();
-  return (*x) >= (*y);
+Value GrtEqBinaryNode::eval() const {
+  return evalOperands<Value::GE>();
 }
 
-const Literal* LessEqBinaryNode::eval() const {
-  if (!left || !right) {
-    throw std::string("Error: left or right of BinaryNode is null");
-  }
-  const Literal* x = left->eval();
-  const Literal* y = right->eval();
-  return (*x) <= (*y);
+Value LessEqBinaryNode::eval() const {
+  return evalOperands<Value::LE>();
 }
\ No newline at end of file
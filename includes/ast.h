@@ -9,42 +9,60 @@
 #include <map>
 #include <vector>
 #include "literal.h"
+#include "quicken.h"
+#include "resolver.h"
 #include "tableManager.h"
 
-extern void yyerror(const char*);
-extern void yyerror(const char*, const char);
-
 class IdentNode : public Node {
 public:
-  IdentNode(const std::string id) : Node(), ident(id) { }
+  IdentNode(const Atom* id) : Node(), ident(id), loc{Location::UNRESOLVED, 0, 0} { }
   virtual ~IdentNode() {}
-  const std::string getIdent() const { return ident; }
-  virtual const Literal* eval() const;
+  const std::string& getIdent() const { return ident->str(); }
+  const Atom* getAtom() const { return ident; }
+  const Location& getLocation() const { return loc; }
+  virtual Value eval() const;
+  virtual void compile(Compiler&) const;
+  virtual void dump(std::ostream&) const;
+  virtual void save(ProgramWriter&) const;
+  virtual void checkPurity(PurityCheck&) const;
+  virtual void resolve(Resolver&);
+  void store(const Value&) const;
+  static void unbound(const std::string&, const Location&);
+  IdentNode(const IdentNode&) = delete;
+  IdentNode& operator=(const IdentNode&) = delete;
 private:
-  std::string ident;
+  const Atom* ident;
+  Location loc;
 };
 
 class NullNode : public Node {
 public:
   static NullNode* getInstance() {
-    if (!instance) instance = new NullNode();
-    return instance;
+    static NullNode instance;
+    return &instance;
   }
-  virtual ~NullNode() { if (instance) delete instance; }
-  virtual const Literal* eval() const { return val; }
+  virtual ~NullNode() {}
+  virtual Value eval() const { return Value(); }
+  virtual void dump(std::ostream&) const;
+  virtual void save(ProgramWriter&) const;
+  virtual void checkPurity(PurityCheck&) const {}
   NullNode(const NullNode&) = delete;
   NullNode& operator=(const NullNode&) = delete;
 private:
-  NullNode() : Node(), val(nullptr) {}
-  Literal* val;
-  static NullNode* instance;
+  NullNode() : Node() {}
 };
 
 class PrintNode : public Node {
 public:
   PrintNode(Node* n) : Node(), node(n) {}
   virtual ~PrintNode() {}
-  virtual const Literal* eval() const;
+  virtual Value eval() const;
+  virtual void compile(Compiler&) const;
+  virtual void resolve(Resolver&);
+  virtual Node* fold(Folder&);
+  virtual void dump(std::ostream&) const;
+  virtual void save(ProgramWriter&) const;
+  virtual void checkPurity(PurityCheck&) const;
   Node* getNode() const { return node; }
   PrintNode(const PrintNode&) = delete;
   PrintNode& operator=(const PrintNode&) = delete;
@@ -56,7 +74,14 @@ class IfNode : public Node {
 public:
   IfNode(Node* cmp, Node* if_branch, Node* else_branch) : Node(), comparison(cmp), ifBranch(if_branch), elseBranch(else_branch) {}
   virtual ~IfNode() {}
-  virtual const Literal* eval() const;
+  virtual Value eval() const;
+  virtual Completion execute() const;
+  virtual void compile(Compiler&) const;
+  virtual void resolve(Resolver&);
+  virtual Node* fold(Folder&);
+  virtual void dump(std::ostream&) const;
+  virtual void save(ProgramWriter&) const;
+  virtual void checkPurity(PurityCheck&) const;
   Node* getIfBranch() const { return ifBranch; }
   Node* getElseBranch() const { return elseBranch; }
   IfNode(const IfNode&) = delete;
@@ -71,8 +96,14 @@ class SuiteNode : public Node {
 public:
   SuiteNode() : Node(), stmts() {}
   virtual ~SuiteNode() {}
-  virtual const Literal* eval() const;
-  void preeval() const;
+  virtual Value eval() const;
+  virtual Completion execute() const;
+  virtual void compile(Compiler&) const;
+  virtual void resolve(Resolver&);
+  virtual Node* fold(Folder&);
+  virtual void dump(std::ostream&) const;
+  virtual void save(ProgramWriter&) const;
+  virtual void checkPurity(PurityCheck&) const;
   void append(Node*);
   SuiteNode(const SuiteNode&) = delete;
   SuiteNode& operator=(const SuiteNode&) = delete;
@@ -82,24 +113,43 @@ private:
 
 class FuncNode : public Node {
 public:
-  FuncNode(char* n, Node* p, Node* s) : Node(), name(n), suite(s), params(p) {}
+  FuncNode(const Atom* n, Node* p, Node* s) : Node(), name(n), suite(s), params(p), frameSize(0) {}
   virtual ~FuncNode() {}
-  virtual const Literal* eval() const;
+  virtual Value eval() const;
+  virtual void compile(Compiler&) const;
+  virtual void resolve(Resolver&);
+  virtual Node* fold(Folder&);
+  virtual void dump(std::ostream&) const;
+  virtual void save(ProgramWriter&) const;
+  virtual void checkPurity(PurityCheck&) const;
+  const Atom* getName() const { return name; }
+  const Node* getSuite() const { return suite; }
+  Node* getSuite() { return suite; }
+  const std::vector<Node*>& getParams() const;
+  unsigned long getFrameSize() const { return frameSize; }
+  void setFrameSize(unsigned long n) { frameSize = n; }
   FuncNode(const FuncNode&) = delete;
   FuncNode& operator=(const FuncNode&) = delete;
 private:
-  std::string name;
+  const Atom* name;
   Node* suite, *params;
+  // parameters first, then the other locals
+  unsigned long frameSize;
 };
 
 class ParamNode : public Node {
 public:
   ParamNode() : Node(), params() {}
   virtual ~ParamNode() {}
-  virtual const Literal* eval() const;
+  virtual Value eval() const;
+  virtual void resolve(Resolver&);
+  virtual Node* fold(Folder&);
+  virtual void dump(std::ostream&) const;
+  virtual void save(ProgramWriter&) const;
+  virtual void checkPurity(PurityCheck&) const;
   void append(Node*);
   void print() const;
-  const std::vector<Node*> getParams();
+  const std::vector<Node*>& getParams() const { return params; }
   ParamNode(const ParamNode&) = delete;
   ParamNode& operator=(const ParamNode&) = delete;
 private:
@@ -108,14 +158,22 @@ private:
 
 class CallNode : public Node {
 public:
-  CallNode(const std::string& n, Node* a)  : Node(), funcName(n), arguments(a) { }
+  CallNode(const Atom* n, Node* a)  : Node(), funcName(n), arguments(a), cache() { }
   virtual ~CallNode() {}
-  virtual const Literal* eval() const;
+  virtual Value eval() const;
+  virtual void compile(Compiler&) const;
+  virtual void resolve(Resolver&);
+  virtual Node* fold(Folder&);
+  virtual void dump(std::ostream&) const;
+  virtual void save(ProgramWriter&) const;
+  virtual void checkPurity(PurityCheck&) const;
+  static void checkArguments(const std::string&, unsigned long, unsigned long);
   CallNode(const CallNode&) = delete;
   CallNode& operator=(const CallNode&) = delete;
 private:
-  std::string funcName;
+  const Atom* funcName;
   Node* arguments;
+  mutable FuncCache cache;
 };
 
 class ReturnNode : public Node {
@@ -123,7 +181,14 @@ public:
   ReturnNode() : Node(), testlist(nullptr) {}
   ReturnNode(Node* n) : Node(), testlist(n) {}
   virtual ~ReturnNode() {}
-  virtual const Literal* eval() const;
+  virtual Value eval() const;
+  virtual Completion execute() const;
+  virtual void compile(Compiler&) const;
+  virtual void resolve(Resolver&);
+  virtual Node* fold(Folder&);
+  virtual void dump(std::ostream&) const;
+  virtual void save(ProgramWriter&) const;
+  virtual void checkPurity(PurityCheck&) const;
   ReturnNode(const ReturnNode&)  = delete;
   ReturnNode& operator=(const ReturnNode&) = delete;
 private:
@@ -134,7 +199,13 @@ class UnaryNode : public Node {
 public:
   UnaryNode(char c, Node* n) : Node(), op(c), node(n) {}
   virtual ~UnaryNode() {}
-  virtual const Literal* eval() const;
+  virtual Value eval() const;
+  virtual void compile(Compiler&) const;
+  virtual void resolve(Resolver&);
+  virtual Node* fold(Folder&);
+  virtual void dump(std::ostream&) const;
+  virtual void save(ProgramWriter&) const;
+  virtual void checkPurity(PurityCheck&) const;
   Node* getNode() const { return node; }
   UnaryNode(const UnaryNode&) = delete;
   UnaryNode& operator=(const UnaryNode&) = delete;
@@ -145,92 +216,145 @@ private:
 
 class BinaryNode : public Node {
 public:
-  BinaryNode(Node* l, Node* r) : Node(), left(l), right(r) {}
-  virtual const Literal* eval() const = 0;
+  BinaryNode(Node* l, Node* r) : Node(), left(l), right(r), feedback() {}
+  virtual Value eval() const = 0;
+  virtual void compile(Compiler&) const = 0;
+  virtual void resolve(Resolver&);
+  virtual Node* fold(Folder&);
+  virtual void checkPurity(PurityCheck&) const;
   Node* getLeft()  const { return left; }
   Node* getRight() const { return right; }
   BinaryNode(const BinaryNode&) = delete;
   BinaryNode& operator=(const BinaryNode&) = delete;
 protected:
+  void compileOperands(Compiler&) const;
+  void dumpOperands(std::ostream&, const char* op) const;
+  void saveOperands(ProgramWriter&, unsigned char tag) const;
+  // left OP right, specialized by the types seen so far
+  template <Value::Op OP> Value evalOperands() const;
   Node *left;
   Node *right;
+  mutable TypeFeedback feedback;
 };
 
 class AsgBinaryNode : public BinaryNode {
 public:
   AsgBinaryNode(Node* left, Node* right) : BinaryNode(left, right) { }
-  virtual const Literal* eval() const;
-  const std::string getIdent() const;
+  virtual Value eval() const;
+  virtual void compile(Compiler&) const;
+  virtual void resolve(Resolver&);
+  virtual Node* fold(Folder&);
+  virtual void dump(std::ostream&) const;
+  virtual void save(ProgramWriter&) const;
+  virtual void checkPurity(PurityCheck&) const;
+  const std::string& getIdent() const;
+  const Atom* getAtom() const;
 };
 
 class AddBinaryNode : public BinaryNode {
 public:
   AddBinaryNode(Node* left, Node* right) : BinaryNode(left, right) { }
-  virtual const Literal* eval() const;
+  virtual Value eval() const;
+  virtual void compile(Compiler&) const;
+  virtual void dump(std::ostream&) const;
+  virtual void save(ProgramWriter&) const;
 };
 
 class SubBinaryNode : public BinaryNode {
 public:
   SubBinaryNode(Node* left, Node* right) : BinaryNode(left, right) { }
-  virtual const Literal* eval() const;
+  virtual Value eval() const;
+  virtual void compile(Compiler&) const;
+  virtual void dump(std::ostream&) const;
+  virtual void save(ProgramWriter&) const;
 };
 
 class MulBinaryNode : public BinaryNode {
 public:
   MulBinaryNode(Node* left, Node* right) : BinaryNode(left, right) {}
-  virtual const Literal* eval() const;
+  virtual Value eval() const;
+  virtual void compile(Compiler&) const;
+  virtual void dump(std::ostream&) const;
+  virtual void save(ProgramWriter&) const;
 };
 
 class DivBinaryNode : public BinaryNode {
 public:
   DivBinaryNode(Node* left, Node* right) : BinaryNode(left, right) { }
-  virtual const Literal* eval() const;
+  virtual Value eval() const;
+  virtual void compile(Compiler&) const;
+  virtual void dump(std::ostream&) const;
+  virtual void save(ProgramWriter&) const;
 };
 
 class IntDivBinaryNode : public BinaryNode {
 public:
   IntDivBinaryNode(Node* left, Node* right) : BinaryNode(left, right) { }
-  virtual const Literal* eval() const;
+  virtual Value eval() const;
+  virtual void compile(Compiler&) const;
+  virtual void dump(std::ostream&) const;
+  virtual void save(ProgramWriter&) const;
 };
 
 class ModBinaryNode : public BinaryNode {
 public:
   ModBinaryNode(Node* left, Node* right) : BinaryNode(left, right) { }
-  virtual const Literal* eval() const;
+  virtual Value eval() const;
+  virtual void compile(Compiler&) const;
+  virtual void dump(std::ostream&) const;
+  virtual void save(ProgramWriter&) const;
 };
 
 class ExpBinaryNode : public BinaryNode {
 public:
   ExpBinaryNode(Node* left, Node* right) : BinaryNode(left, right) { }
-  virtual const Literal* eval() const;
+  virtual Value eval() const;
+  virtual void compile(Compiler&) const;
+  virtual void dump(std::ostream&) const;
+  virtual void save(ProgramWriter&) const;
 };
 
 class LessBinaryNode : public BinaryNode {
 public:
   LessBinaryNode(Node* left, Node* right) : BinaryNode(left, right) {}
-  virtual const Literal* eval() const;
+  virtual Value eval() const;
+  virtual void compile(Compiler&) const;
+  virtual void dump(std::ostream&) const;
+  virtual void save(ProgramWriter&) const;
 };
 
 class GreaterBinaryNode : public BinaryNode {
 public:
   GreaterBinaryNode(Node* left, Node* right) : BinaryNode(left, right) {}
-  virtual const Literal* eval() const;
+  virtual Value eval() const;
+  virtual void compile(Compiler&) const;
+  virtual void dump(std::ostream&) const;
+  virtual void save(ProgramWriter&) const;
 };
 
 class EqualBinaryNode : public BinaryNode {
 public:
   EqualBinaryNode(Node* left, Node* right) : BinaryNode(left, right) {}
-  virtual const Literal* eval() const;
+  virtual Value eval() const;
+  virtual void compile(Compiler&) const;
+  virtual void dump(std::ostream&) const;
+  virtual void save(ProgramWriter&) const;
 };
 
 class GrtEqBinaryNode : public BinaryNode {
 public:
   GrtEqBinaryNode(Node* left, Node* right) : BinaryNode(left, right) {}
-  virtual const Literal* eval() const;
+  virtual Value eval() const;
+  virtual void compile(Compiler&) const;
+  virtual void dump(std::ostream&) const;
+  virtual void save(ProgramWriter&) const;
 };
 
 class LessEqBinaryNode : public BinaryNode {
 public:
   LessEqBinaryNode(Node* left, Node* right) : BinaryNode(left, right) {}
-  virtual const Literal* eval() const;
+  virtual Value eval() const;
+  virtual void compile(Compiler&) const;
+  virtual void dump(std::ostream&) const;
+  virtual void save(ProgramWriter&) const;
 };
@@ -0,0 +1,418 @@
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <utility>
+#include "bigint.h"
+
+namespace {
+
+typedef BigInt::Digit Digit;
+typedef std::vector<Digit> Mag;
+typedef uint64_t Wide;
+
+// operands shorter than this many digits are multiplied schoolbook
+const unsigned long karatsubaCutoff = 40;
+
+const Digit decimalChunk = 1000000000;
+const int decimalChunkDigits = 9;
+// numbers shorter than this many digits are converted to decimal by
+// dividing by 10**9 repeatedly, longer ones are split in halves first
+const unsigned long decimalSplitCutoff = 64;
+
+void trim(Mag& m) {
+  while (!m.empty() && m.back() == 0) m.pop_back();
+}
+
+int compareMag(const Mag& a, const Mag& b) {
+  if (a.size() != b.size()) return a.size() < b.size() ? -1 : 1;
+  for (unsigned long i = a.size(); i-- > 0; ) {
+    if (a[i] != b[i]) return a[i] < b[i] ? -1 : 1;
+  }
+  return 0;
+}
+
+Mag addMag(const Digit* a, unsigned long n, const Digit* b, unsigned long m) {
+  if (n < m) {
+    std::swap(a, b);
+    std::swap(n, m);
+  }
+  Mag res(n + 1);
+  Wide carry = 0;
+  for (unsigned long i = 0; i < n; ++i) {
+    carry += static_cast<Wide>(a[i]) + (i < m ? b[i] : 0);
+    res[i] = static_cast<Digit>(carry);
+    carry >>= 32;
+  }
+  res[n] = static_cast<Digit>(carry);
+  trim(res);
+  return res;
+}
+
+// x -= y, where x >= y
+void subMag(Mag& x, const Digit* y, unsigned long m) {
+  Wide borrow = 0;
+  for (unsigned long i = 0; i < x.size() && (i < m || borrow); ++i) {
+    const Wide d = static_cast<Wide>(x[i]) - (i < m ? y[i] : 0) - borrow;
+    x[i] = static_cast<Digit>(d);
+    borrow = d >> 63;
+  }
+  trim(x);
+}
+
+// out[at..] += y; the sum fits in out
+void addAt(Digit* out, unsigned long size, unsigned long at, const Mag& y) {
+  Wide carry = 0;
+  for (unsigned long i = 0; at + i < size && (i < y.size() || carry); ++i) {
+    carry += static_cast<Wide>(out[at + i]) + (i < y.size() ? y[i] : 0);
+    out[at + i] = static_cast<Digit>(carry);
+    carry >>= 32;
+  }
+}
+
+Mag mulMag(const Digit* a, unsigned long n, const Digit* b, unsigned long m);
+
+// out[0, n + m) = a * b, out starts zeroed
+void mulInto(const Digit* a, unsigned long n, const Digit* b, unsigned long m, Digit* out) {
+  if (n < m) {
+    std::swap(a, b);
+    std::swap(n, m);
+  }
+  if (m < karatsubaCutoff) {
+    for (unsigned long j = 0; j < m; ++j) {
+      const Wide bj = b[j];
+      if (!bj) continue;
+      Wide carry = 0;
+      for (unsigned long i = 0; i < n; ++i) {
+        carry += bj * a[i] + out[i + j];
+        out[i + j] = static_cast<Digit>(carry);
+        carry >>= 32;
+      }
+      out[j + n] = static_cast<Digit>(carry);
+    }
+    return;
+  }
+  const unsigned long half = (n + 1) / 2;
+  if (m <= half) {
+    // too lopsided to split b: a = a1 * B**half + a0
+    mulInto(a, half, b, m, out);
+    addAt(out, n + m, half, mulMag(a + half, n - half, b, m));
+    return;
+  }
+  // a * b = z2 * B**(2 half) + z1 * B**half + z0, with three multiplications
+  const Mag z0 = mulMag(a, half, b, half);
+  const Mag z2 = mulMag(a + half, n - half, b + half, m - half);
+  const Mag sa = addMag(a, half, a + half, n - half);
+  const Mag sb = addMag(b, half, b + half, m - half);
+  Mag z1 = mulMag(sa.data(), sa.size(), sb.data(), sb.size());
+  subMag(z1, z0.data(), z0.size());
+  subMag(z1, z2.data(), z2.size());
+  addAt(out, n + m, 0, z0);
+  addAt(out, n + m, half, z1);
+  addAt(out, n + m, 2 * half, z2);
+}
+
+Mag mulMag(const Digit* a, unsigned long n, const Digit* b, unsigned long m) {
+  if (!n || !m) return Mag();
+  Mag res(n + m);
+  mulInto(a, n, b, m, res.data());
+  trim(res);
+  return res;
+}
+
+// q = u / d, returns u % d
+Digit divSmall(const Mag& u, Digit d, Mag& q) {
+  q.assign(u.size(), 0);
+  Wide rem = 0;
+  for (unsigned long i = u.size(); i-- > 0; ) {
+    const Wide cur = (rem << 32) | u[i];
+    q[i] = static_cast<Digit>(cur / d);
+    rem = cur % d;
+  }
+  trim(q);
+  return static_cast<Digit>(rem);
+}
+
+// truncating division of magnitudes, Knuth's algorithm D
+void divModMag(const Mag& u, const Mag& v, Mag& q, Mag& r) {
+  if (compareMag(u, v) < 0) {
+    q.clear();
+    r = u;
+    return;
+  }
+  if (v.size() == 1) {
+    const Digit rem = divSmall(u, v[0], q);
+    r.clear();
+    if (rem) r.push_back(rem);
+    return;
+  }
+  const unsigned long m = u.size(), n = v.size();
+  // normalize so that the top digit of the divisor has its high bit set
+  const int s = __builtin_clz(v[n - 1]);
+  Mag vn(n), un(m + 1);
+  for (unsigned long i = n - 1; i > 0; --i) {
+    vn[i] = (v[i] << s) | (s ? v[i - 1] >> (32 - s) : 0);
+  }
+  vn[0] = v[0] << s;
+  un[m] = s ? u[m - 1] >> (32 - s) : 0;
+  for (unsigned long i = m - 1; i > 0; --i) {
+    un[i] = (u[i] << s) | (s ? u[i - 1] >> (32 - s) : 0);
+  }
+  un[0] = u[0] << s;
+
+  const Wide base = Wide(1) << 32;
+  q.assign(m - n + 1, 0);
+  for (unsigned long j = m - n + 1; j-- > 0; ) {
+    // estimate the quotient digit from the top two digits, then correct it
+    const Wide num = (static_cast<Wide>(un[j + n]) << 32) | un[j + n - 1];
+    Wide qhat = num / vn[n - 1];
+    Wide rhat = num % vn[n - 1];
+    while (qhat >= base || qhat * vn[n - 2] > ((rhat << 32) | un[j + n - 2])) {
+      --qhat;
+      rhat += vn[n - 1];
+      if (rhat >= base) break;
+    }
+    // un[j, j + n] -= qhat * vn
+    Wide carry = 0, borrow = 0;
+    for (unsigned long i = 0; i < n; ++i) {
+      const Wide p = qhat * vn[i] + carry;
+      carry = p >> 32;
+      const Wide d = static_cast<Wide>(un[i + j]) - (p & 0xffffffff) - borrow;
+      un[i + j] = static_cast<Digit>(d);
+      borrow = d >> 63;
+    }
+    const Wide d = static_cast<Wide>(un[j + n]) - carry - borrow;
+    un[j + n] = static_cast<Digit>(d);
+    q[j] = static_cast<Digit>(qhat);
+    if (d >> 63) {
+      // qhat was one too large: add the divisor back
+      --q[j];
+      Wide c = 0;
+      for (unsigned long i = 0; i < n; ++i) {
+        c += static_cast<Wide>(un[i + j]) + vn[i];
+        un[i + j] = static_cast<Digit>(c);
+        c >>= 32;
+      }
+      un[j + n] += static_cast<Digit>(c);
+    }
+  }
+  trim(q);
+  r.resize(n);
+  for (unsigned long i = 0; i < n; ++i) {
+    r[i] = (un[i] >> s) | (s ? static_cast<Digit>(static_cast<Wide>(un[i + 1]) << (32 - s)) : 0);
+  }
+  trim(r);
+}
+
+// m /= 10**9, returns m % 10**9; the divisor is a constant, so the
+// compiler divides by multiplying
+Digit divChunk(Mag& m) {
+  Wide rem = 0;
+  for (unsigned long i = m.size(); i-- > 0; ) {
+    const Wide cur = (rem << 32) | m[i];
+    m[i] = static_cast<Digit>(cur / decimalChunk);
+    rem = cur % decimalChunk;
+  }
+  trim(m);
+  return static_cast<Digit>(rem);
+}
+
+// Appends the decimal digits of m to out, zero-padded to width. powers[k]
+// is 10**(9 * 2**k), and m < powers[k]**2: dividing by powers[k] splits m
+// into halves of as many decimal digits, which are converted in turn.
+void appendDecimal(Mag&& m, unsigned long width, const std::vector<Mag>& powers,
+                   unsigned long k, std::string& out) {
+  if (m.size() < decimalSplitCutoff || k == 0) {
+    // nine decimal digits per division, least significant first
+    std::vector<Digit> chunks;
+    while (!m.empty()) chunks.push_back(divChunk(m));
+    const unsigned long start = out.size();
+    char buf[16];
+    for (unsigned long i = chunks.size(); i-- > 0; ) {
+      snprintf(buf, sizeof(buf), start == out.size() ? "%u" : "%09u", chunks[i]);
+      out += buf;
+    }
+    if (out.size() - start < width) out.insert(start, width - (out.size() - start), '0');
+    return;
+  }
+  --k;
+  const unsigned long half = decimalChunkDigits << k;
+  Mag high, low;
+  divModMag(m, powers[k], high, low);
+  // unpadded, the leading digits are the low half's if the high one is zero
+  const bool leading = high.empty() && !width;
+  appendDecimal(std::move(high), width > half ? width - half : 0, powers, k, out);
+  appendDecimal(std::move(low), leading ? 0 : half, powers, k, out);
+}
+
+// m = m * mul + add
+void mulAddSmall(Mag& m, Digit mul, Digit add) {
+  Wide carry = add;
+  for (Digit& d : m) {
+    carry += static_cast<Wide>(d) * mul;
+    d = static_cast<Digit>(carry);
+    carry >>= 32;
+  }
+  if (carry) m.push_back(static_cast<Digit>(carry));
+}
+
+}
+
+BigInt::BigInt(long v) : negative(v < 0), digits() {
+  Wide mag = negative ? Wide(0) - static_cast<Wide>(v) : static_cast<Wide>(v);
+  while (mag) {
+    digits.push_back(static_cast<Digit>(mag));
+    mag >>= 32;
+  }
+}
+
+BigInt::BigInt(bool neg, const Digit* d, unsigned long n) : negative(false), digits(d, d + n) {
+  trim(digits);
+  negative = neg && !digits.empty();
+}
+
+BigInt::BigInt(bool neg, std::vector<Digit>&& mag) : negative(false), digits(std::move(mag)) {
+  trim(digits);
+  negative = neg && !digits.empty();
+}
+
+BigInt BigInt::parse(const char* s, unsigned long n) {
+  Mag mag;
+  unsigned long i = 0;
+  while (i < n) {
+    // the first chunk takes the odd digits, so the rest are all full
+    const unsigned long len = i == 0 && n % decimalChunkDigits ? n % decimalChunkDigits : decimalChunkDigits;
+    Digit chunk = 0, scale = 1;
+    for (unsigned long k = 0; k < len; ++k, ++i) {
+      chunk = chunk * 10 + (s[i] - '0');
+      scale *= 10;
+    }
+    mulAddSmall(mag, scale, chunk);
+  }
+  return BigInt(false, std::move(mag));
+}
+
+BigInt BigInt::fromDouble(double v) {
+  int exp;
+  // |v| = frac * 2**exp, with 1/2 <= frac < 1
+  const double frac = std::frexp(std::fabs(v), &exp);
+  if (exp < 64) return BigInt(static_cast<long>(v));
+  // all 53 bits of the mantissa, at the top of a word, shifted into place
+  const Wide mantissa = static_cast<Wide>(std::ldexp(frac, 64));
+  const int shift = exp - 64, bits = shift % 32;
+  Mag mag(shift / 32, 0);
+  mag.push_back(static_cast<Digit>(mantissa << bits));
+  mag.push_back(static_cast<Digit>(mantissa >> (32 - bits)));
+  mag.push_back(bits ? static_cast<Digit>(mantissa >> (64 - bits)) : 0);
+  return BigInt(v < 0, std::move(mag));
+}
+
+bool BigInt::fitsLong() const {
+  if (digits.size() > 2) return false;
+  Wide mag = 0;
+  for (unsigned long i = digits.size(); i-- > 0; ) {
+    mag = (mag << 32) | digits[i];
+  }
+  return mag <= static_cast<Wide>(LONG_MAX) + negative;
+}
+
+long BigInt::toLong() const {
+  Wide mag = 0;
+  for (unsigned long i = digits.size(); i-- > 0; ) {
+    mag = (mag << 32) | digits[i];
+  }
+  return static_cast<long>(negative ? Wide(0) - mag : mag);
+}
+
+double BigInt::toDouble() const {
+  const unsigned long n = digits.size();
+  const unsigned long bits = 32 * n - (n ? __builtin_clz(digits.back()) : 32);
+  double res;
+  if (bits <= 64) {
+    res = static_cast<double>(static_cast<Wide>(n > 1 ? digits[1] : 0) << 32 | (n ? digits[0] : 0));
+  } else {
+    // the top 64 bits round to 53 as the whole would: the conversion
+    // rounds once, and a bit below them that is set, or'ed into the
+    // last, breaks what would otherwise look like a tie
+    const unsigned long shift = bits - 64, at = shift / 32;
+    const int offset = shift % 32;
+    Wide top = static_cast<Wide>(digits[at + 1]) << (32 - offset) | digits[at] >> offset;
+    if (offset) top |= static_cast<Wide>(digits[at + 2]) << (64 - offset);
+    bool sticky = offset && (digits[at] & ((Digit(1) << offset) - 1));
+    for (unsigned long i = 0; i < at && !sticky; ++i) {
+      sticky = digits[i] != 0;
+    }
+    res = std::ldexp(static_cast<double>(top | sticky), shift);
+  }
+  if (std::isinf(res)) throw std::string("OverflowError: long int too large to convert to float");
+  return negative ? -res : res;
+}
+
+std::string BigInt::toString() const {
+  if (digits.empty()) return "0";
+  // 10**(9 * 2**k), until the square of the last is longer than the number
+  std::vector<Mag> powers(1, Mag(1, decimalChunk));
+  while (digits.size() >= decimalSplitCutoff && 2 * powers.back().size() - 1 <= digits.size()) {
+    const Mag& last = powers.back();
+    powers.push_back(mulMag(last.data(), last.size(), last.data(), last.size()));
+  }
+  std::string res(negative ? "-" : "");
+  appendDecimal(Mag(digits), 0, powers, powers.size(), res);
+  return res;
+}
+
+BigInt BigInt::operator-() const {
+  BigInt res(*this);
+  res.negative = !negative && !digits.empty();
+  return res;
+}
+
+BigInt operator+(const BigInt& x, const BigInt& y) {
+  if (x.negative == y.negative) {
+    return BigInt(x.negative, addMag(x.digits.data(), x.digits.size(), y.digits.data(), y.digits.size()));
+  }
+  // opposite signs: the larger magnitude wins
+  const bool xLarger = compareMag(x.digits, y.digits) >= 0;
+  const BigInt& large = xLarger ? x : y;
+  const BigInt& small = xLarger ? y : x;
+  Mag mag(large.digits);
+  subMag(mag, small.digits.data(), small.digits.size());
+  return BigInt(large.negative, std::move(mag));
+}
+
+BigInt operator-(const BigInt& x, const BigInt& y) {
+  return x + -y;
+}
+
+BigInt operator*(const BigInt& x, const BigInt& y) {
+  return BigInt(x.negative != y.negative,
+                mulMag(x.digits.data(), x.digits.size(), y.digits.data(), y.digits.size()));
+}
+
+void BigInt::divMod(const BigInt& x, const BigInt& y, BigInt& q, BigInt& r) {
+  if (y.isZero()) throw std::string("ZeroDivisionError: long division or modulo by zero");
+  Mag qm, rm;
+  divModMag(x.digits, y.digits, qm, rm);
+  q = BigInt(x.negative != y.negative, std::move(qm));
+  r = BigInt(x.negative, std::move(rm));
+  // truncation rounds toward zero, Python rounds toward minus infinity
+  if (!r.isZero() && r.negative != y.negative) {
+    q = q - BigInt(1L);
+    r = r + y;
+  }
+}
+
+BigInt BigInt::pow(unsigned long exp) const {
+  BigInt res(1L), base(*this);
+  while (exp) {
+    if (exp & 1) res = res * base;
+    exp >>= 1;
+    if (exp) base = base * base;
+  }
+  return res;
+}
+
+int BigInt::compare(const BigInt& x, const BigInt& y) {
+  if (x.negative != y.negative) return x.negative ? -1 : 1;
+  const int cmp = compareMag(x.digits, y.digits);
+  return x.negative ? -cmp : cmp;
+}
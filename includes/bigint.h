@@ -0,0 +1,55 @@
+#pragma once
+
+//  Arbitrary-precision integers. An int is a machine word (Value::INT)
+//  until an operation on it overflows; the result is then a long,
+//  kept on the collected heap as a LongObject (gc.h). A BigInt is the
+//  working form of a long: the arithmetic is done on BigInts, and
+//  value.cpp converts between them and Values. A result that fits in
+//  a machine word always goes back to being an int.
+//
+//  Digits are base 2**32, least significant first, with no leading
+//  zero digits; zero has no digits. Multiplication switches from
+//  schoolbook to Karatsuba for large operands, division is Knuth's
+//  algorithm D, and decimal conversion splits a large number in halves
+//  by powers of 10**9 before working nine digits at a time.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class BigInt {
+public:
+  typedef uint32_t Digit;
+
+  BigInt() : negative(false), digits() {}
+  explicit BigInt(long);
+  BigInt(bool negative, const Digit* digits, unsigned long n);
+  // a run of decimal digits, without sign
+  static BigInt parse(const char* s, unsigned long n);
+  // a finite double with no fraction, exactly
+  static BigInt fromDouble(double);
+
+  bool isNegative() const { return negative; }
+  bool isZero() const { return digits.empty(); }
+  const std::vector<Digit>& getDigits() const { return digits; }
+  bool fitsLong() const;
+  long toLong() const;
+  // raises OverflowError when the value is out of range of a double
+  double toDouble() const;
+  std::string toString() const;
+
+  BigInt operator-() const;
+  friend BigInt operator+(const BigInt&, const BigInt&);
+  friend BigInt operator-(const BigInt&, const BigInt&);
+  friend BigInt operator*(const BigInt&, const BigInt&);
+  // floor division and modulo as in Python, y must not be zero
+  static void divMod(const BigInt& x, const BigInt& y, BigInt& q, BigInt& r);
+  BigInt pow(unsigned long exp) const;
+  // -1, 0 or 1
+  static int compare(const BigInt&, const BigInt&);
+
+private:
+  BigInt(bool neg, std::vector<Digit>&& mag);
+  bool negative;
+  std::vector<Digit> digits;
+};
@@ -0,0 +1,97 @@
+#pragma once
+
+//  Instruction set and code objects for the bytecode engine.
+//  The compiler (compiler.cpp) lowers the AST into a Code object,
+//  the virtual machine (vm.cpp) executes it.
+
+#include <string>
+#include <vector>
+#include "value.h"
+#include "resolver.h"
+#include "tableManager.h"
+
+class Atom;
+class Node;
+class FuncNode;
+
+// keep in sync with the dispatch table in VirtualMachine::run
+enum Opcode : unsigned char {
+  LOAD_CONST,       // push constants[arg]
+  LOAD_LOCAL,       // push slot arg of the current frame
+  STORE_LOCAL,      // pop into slot arg of the current frame
+  LOAD_ENCLOSING,   // push the enclosing-scope variable variables[arg]
+  LOAD_GLOBAL,      // push global slot arg
+  STORE_GLOBAL,     // pop into global slot arg
+  BINARY_ADD,
+  BINARY_SUB,
+  BINARY_MUL,
+  BINARY_DIV,
+  BINARY_INT_DIV,
+  BINARY_MOD,
+  BINARY_POW,
+  COMPARE_LT,
+  COMPARE_GT,
+  COMPARE_EQ,
+  COMPARE_GE,
+  COMPARE_LE,
+  UNARY_OP,         // arg is the operator character: + - ~
+  PRINT_ITEM,       // pop and print
+  PRINT_NEWLINE,
+  POP_TOP,
+  DUP_TOP,
+  JUMP,             // pc = arg
+  JUMP_IF_FALSE,    // pop, pc = arg if false
+  MAKE_FUNCTION,    // bind functions[arg] in the current scope
+  CALL_FUNCTION,    // call calls[arg], arguments are on the stack
+  RETURN_VALUE,     // pop and return from the code object
+  RETURN_NONE
+};
+
+struct Instruction {
+  Opcode op;
+  int arg;
+};
+
+// a variable referenced by the code, kept for error messages
+struct Variable {
+  const Atom* name;
+  Location loc;
+};
+
+struct CallSite {
+  const Atom* name;
+  int argc;
+  mutable FuncCache cache;
+};
+
+struct JitFrame;
+typedef int (*NativeCode)(JitFrame*);
+
+// what the JIT (jit.h) knows of a code object
+struct JitState {
+  unsigned long calls;
+  NativeCode native;
+  unsigned long bailouts;
+  bool rejected;  // not to be compiled, or no longer run natively
+};
+
+class Code {
+public:
+  Code() : instructions(), constants(), variables(), functions(), calls(), lines(), maxStack(0),
+    jit{0, nullptr, 0, false} {}
+  // the name of the local or global in slot
+  const std::string& nameOf(Location::Kind, int slot) const;
+  // the line of the statement instruction pc belongs to, 0 if unknown
+  int lineAt(int pc) const;
+  std::vector<Instruction> instructions;
+  std::vector<Value> constants;
+  std::vector<Variable> variables;
+  std::vector<const FuncNode*> functions;
+  std::vector<CallSite> calls;
+  // the first instruction and line of each statement, kept while profiling
+  std::vector<std::pair<int, int> > lines;
+  int maxStack;
+  mutable JitState jit;
+  Code(const Code&) = delete;
+  Code& operator=(const Code&) = delete;
+};
@@ -0,0 +1,256 @@
+#include <algorithm>
+#include <climits>
+#include "compiler.h"
+#include "ast.h"
+#include "profiler.h"
+
+void Compiler::compileStatement(const Node* stmt) {
+  if (!stmt) return;
+  Profiler& profiler = Profiler::getInstance();
+  if (profiler.isEnabled()) {
+    if (const int line = profiler.lineOf(stmt)) {
+      code.lines.push_back(std::make_pair(static_cast<int>(code.instructions.size()), line));
+    }
+  }
+  const int before = depth;
+  stmt->compile(*this);
+  while (depth > before) {
+    emit(POP_TOP);
+  }
+}
+
+void Compiler::emit(Opcode op, int arg) {
+  code.instructions.push_back(Instruction{op, arg});
+
+  switch (op) {
+    case LOAD_CONST:
+    case LOAD_LOCAL:
+    case LOAD_ENCLOSING:
+    case LOAD_GLOBAL:
+    case DUP_TOP:
+      ++depth; break;
+    case STORE_LOCAL:
+    case STORE_GLOBAL:
+    case POP_TOP:
+    case PRINT_ITEM:
+    case JUMP_IF_FALSE:
+    case RETURN_VALUE:
+    case BINARY_ADD: case BINARY_SUB: case BINARY_MUL: case BINARY_DIV:
+    case BINARY_INT_DIV: case BINARY_MOD: case BINARY_POW:
+    case COMPARE_LT: case COMPARE_GT: case COMPARE_EQ:
+    case COMPARE_GE: case COMPARE_LE:
+      --depth; break;
+    case CALL_FUNCTION:
+      depth += 1 - code.calls[arg].argc; break;
+    default:
+      break;
+  }
+  code.maxStack = std::max(code.maxStack, depth);
+}
+
+int Compiler::emitJump(Opcode op) {
+  emit(op, -1);
+  return code.instructions.size() - 1;
+}
+
+void Compiler::patch(int at) {
+  code.instructions[at].arg = code.instructions.size();
+}
+
+int Compiler::addConst(const Value& val) {
+  for (unsigned long i = 0; i < code.constants.size(); ++i) {
+    if (code.constants[i].isSame(val)) return i;
+  }
+  code.constants.push_back(val);
+  return code.constants.size() - 1;
+}
+
+int Compiler::addVariable(const Atom* name, const Location& loc) {
+  for (unsigned long i = 0; i < code.variables.size(); ++i) {
+    if (code.variables[i].name == name) return i;
+  }
+  code.variables.push_back(Variable{name, loc});
+  return code.variables.size() - 1;
+}
+
+int Compiler::addFunction(const FuncNode* func) {
+  code.functions.push_back(func);
+  return code.functions.size() - 1;
+}
+
+const std::string& Code::nameOf(Location::Kind kind, int slot) const {
+  for (const Variable& var : variables) {
+    if (var.loc.kind == kind && var.loc.slot == slot) return var.name->str();
+  }
+  static const std::string unknown("?");
+  return unknown;
+}
+
+int Code::lineAt(int pc) const {
+  std::vector<std::pair<int, int> >::const_iterator it =
+    std::upper_bound(lines.begin(), lines.end(), std::make_pair(pc, INT_MAX));
+  return it == lines.begin() ? 0 : (it - 1)->second;
+}
+
+int Compiler::addCall(const Atom* name, int argc) {
+  code.calls.push_back(CallSite{name, argc, FuncCache()});
+  return code.calls.size() - 1;
+}
+
+// Lowering of the AST into bytecode. Expressions leave exactly one
+// value on the stack, statements leave none.
+
+void Node::compile(Compiler&) const {
+  throw std::string("SyntaxError: unsupported construct for the bytecode engine");
+}
+
+void Literal::compile(Compiler& c) const {
+  c.emit(LOAD_CONST, c.addConst(getValue()));
+}
+
+void IdentNode::compile(Compiler& c) const {
+  const int var = c.addVariable(ident, loc);
+  switch (loc.kind) {
+    case Location::LOCAL: c.emit(LOAD_LOCAL, loc.slot); break;
+    case Location::ENCLOSING: c.emit(LOAD_ENCLOSING, var); break;
+    case Location::GLOBAL: c.emit(LOAD_GLOBAL, loc.slot); break;
+    default: throw std::string("SystemError: unresolved name ") + ident->str();
+  }
+}
+
+void PrintNode::compile(Compiler& c) const {
+  if (!node) {
+    c.emit(PRINT_NEWLINE);
+    return;
+  }
+  node->compile(c);
+  c.emit(PRINT_ITEM);
+}
+
+void IfNode::compile(Compiler& c) const {
+  if (!comparison) {
+    throw std::string("comparison is null");
+  }
+  comparison->compile(c);
+  int toElse = c.emitJump(JUMP_IF_FALSE);
+  c.compileStatement(ifBranch);
+  if (elseBranch) {
+    int toEnd = c.emitJump(JUMP);
+    c.patch(toElse);
+    c.compileStatement(elseBranch);
+    c.patch(toEnd);
+  } else {
+    c.patch(toElse);
+  }
+}
+
+void SuiteNode::compile(Compiler& c) const {
+  for (const Node* stmt : stmts) {
+    c.compileStatement(stmt);
+  }
+}
+
+void FuncNode::compile(Compiler& c) const {
+  c.emit(MAKE_FUNCTION, c.addFunction(this));
+}
+
+void CallNode::compile(Compiler& c) const {
+  const std::vector<Node*>& args = static_cast<ParamNode*>(arguments)->getParams();
+  for (const Node* arg : args) {
+    arg->compile(c);
+  }
+  c.emit(CALL_FUNCTION, c.addCall(funcName, args.size()));
+}
+
+void ReturnNode::compile(Compiler& c) const {
+  if (!testlist) {
+    c.emit(RETURN_NONE);
+    return;
+  }
+  testlist->compile(c);
+  c.emit(RETURN_VALUE);
+}
+
+void UnaryNode::compile(Compiler& c) const {
+  node->compile(c);
+  c.emit(UNARY_OP, op);
+}
+
+void AsgBinaryNode::compile(Compiler& c) const {
+  if (!left || !right) {
+    throw std::string("Error: left or right of BinaryNode is null");
+  }
+  right->compile(c);
+  c.emit(DUP_TOP);
+  const Location& loc = static_cast<IdentNode*>(left)->getLocation();
+  c.addVariable(getAtom(), loc);
+  c.emit(loc.kind == Location::LOCAL ? STORE_LOCAL : STORE_GLOBAL, loc.slot);
+}
+
+void BinaryNode::compileOperands(Compiler& c) const {
+  if (!left || !right) {
+    throw std::string("Error: left or right of BinaryNode is null");
+  }
+  left->compile(c);
+  right->compile(c);
+}
+
+void AddBinaryNode::compile(Compiler& c) const {
+  compileOperands(c);
+  c.emit(BINARY_ADD);
+}
+
+void SubBinaryNode::compile(Compiler& c) const {
+  compileOperands(c);
+  c.emit(BINARY_SUB);
+}
+
+void MulBinaryNode::compile(Compiler& c) const {
+  compileOperands(c);
+  c.emit(BINARY_MUL);
+}
+
+void DivBinaryNode::compile(Compiler& c) const {
+  compileOperands(c);
+  c.emit(BINARY_DIV);
+}
+
+void IntDivBinaryNode::compile(Compiler& c) const {
+  compileOperands(c);
+  c.emit(BINARY_INT_DIV);
+}
+
+void ModBinaryNode::compile(Compiler& c) const {
+  compileOperands(c);
+  c.emit(BINARY_MOD);
+}
+
+void ExpBinaryNode::compile(Compiler& c) const {
+  compileOperands(c);
+  c.emit(BINARY_POW);
+}
+
+void LessBinaryNode::compile(Compiler& c) const {
+  compileOperands(c);
+  c.emit(COMPARE_LT);
+}
+
+void GreaterBinaryNode::compile(Compiler& c) const {
+  compileOperands(c);
+  c.emit(COMPARE_GT);
+}
+
+void EqualBinaryNode::compile(Compiler& c) const {
+  compileOperands(c);
+  c.emit(COMPARE_EQ);
+}
+
+void GrtEqBinaryNode::compile(Compiler& c) const {
+  compileOperands(c);
+  c.emit(COMPARE_GE);
+}
+
+void LessEqBinaryNode::compile(Compiler& c) const {
+  compileOperands(c);
+  c.emit(COMPARE_LE);
+}
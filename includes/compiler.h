@@ -0,0 +1,29 @@
+#pragma once
+
+#include "bytecode.h"
+
+class Node;
+
+class Compiler {
+public:
+  Compiler(Code& c) : code(c), depth(0) {}
+
+  // compile a statement, discarding any value it leaves on the stack
+  void compileStatement(const Node*);
+
+  void emit(Opcode op, int arg = 0);
+  // emit a jump whose target is filled in later by patch()
+  int emitJump(Opcode op);
+  void patch(int at);
+
+  int addConst(const Value&);
+  int addVariable(const Atom*, const Location&);
+  int addFunction(const FuncNode*);
+  int addCall(const Atom*, int);
+
+  Compiler(const Compiler&) = delete;
+  Compiler& operator=(const Compiler&) = delete;
+private:
+  Code& code;
+  int depth; // current operand stack depth
+};
@@ -0,0 +1,86 @@
+#include <cstring>
+#include <iostream>
+#include "constants.h"
+#include "bigint.h"
+#include "gc.h"
+
+ConstantPool& ConstantPool::getInstance() {
+  static thread_local ConstantPool pool;
+  return pool;
+}
+
+ConstantPool::ConstantPool() :
+  small(), trueLiteral(nullptr), falseLiteral(nullptr), noneLiteral(nullptr),
+  ints(), floats(), strings(), longs(), lookups(0), created(0) {
+  PoolOfNodes& pool = PoolOfNodes::getInstance();
+  for (long i = minSmall; i <= maxSmall; ++i) {
+    small[i - minSmall] = pool.make<Literal>(Value(i));
+  }
+  trueLiteral = pool.make<Literal>(Value::boolean(true));
+  falseLiteral = pool.make<Literal>(Value::boolean(false));
+  noneLiteral = pool.make<Literal>(Value());
+}
+
+Literal* ConstantPool::integer(long i) {
+  ++lookups;
+  if (i >= minSmall && i <= maxSmall) return small[i - minSmall];
+  Literal*& lit = ints[i];
+  if (!lit) {
+    lit = PoolOfNodes::getInstance().make<Literal>(Value(i));
+    ++created;
+  }
+  return lit;
+}
+
+Literal* ConstantPool::integer(const BigInt& n) {
+  if (n.fitsLong()) return integer(n.toLong());
+  ++lookups;
+  Literal*& lit = longs[n.toString()];
+  if (!lit) {
+    const std::vector<BigInt::Digit>& digits = n.getDigits();
+    LongObject* num = Heap::getInstance().constantLong(n.isNegative(), digits.data(), digits.size());
+    lit = PoolOfNodes::getInstance().make<Literal>(Value::longInt(num));
+    ++created;
+  }
+  return lit;
+}
+
+Literal* ConstantPool::number(double f) {
+  ++lookups;
+  unsigned long long bits = 0;
+  static_assert(sizeof(bits) == sizeof(f), "a double is 64 bits");
+  std::memcpy(&bits, &f, sizeof(f));
+  Literal*& lit = floats[bits];
+  if (!lit) {
+    lit = PoolOfNodes::getInstance().make<Literal>(Value(f));
+    ++created;
+  }
+  return lit;
+}
+
+Literal* ConstantPool::string(const char* s, unsigned long n) {
+  ++lookups;
+  Literal*& lit = strings[std::string(s, n)];
+  if (!lit) {
+    StrObject* str = Heap::getInstance().constantString(s, n);
+    lit = PoolOfNodes::getInstance().make<Literal>(Value::string(str));
+    ++created;
+  }
+  return lit;
+}
+
+Literal* ConstantPool::literal(const Value& val) {
+  switch (val.getType()) {
+    case Value::BOOL: return boolean(val.boolValue());
+    case Value::INT: return integer(val.getInt());
+    case Value::FLOAT: return number(val.getFloat());
+    case Value::STR: return string(val.getStr()->chars(), val.getStr()->length());
+    case Value::LONG: return integer(val.toBigInt());
+    default: return none();
+  }
+}
+
+void ConstantPool::printStats(std::ostream& out) const {
+  out << "constants: " << lookups << " literals, " << created << " made, the rest shared or among the "
+      << maxSmall - minSmall + 4 << " preallocated" << std::endl;
+}
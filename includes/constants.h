@@ -0,0 +1,55 @@
+#pragma once
+
+//  Program constants. Every literal in the program text, and every
+//  constant the folder computes, is looked up here, so each distinct
+//  constant has a single Literal node shared by all its occurrences,
+//  and equal string constants share one heap string. Small ints and
+//  the singletons True, False and None are made up front and found
+//  without hashing.
+
+#include <iosfwd>
+#include <string>
+#include <unordered_map>
+#include "literal.h"
+
+class BigInt;
+
+class ConstantPool {
+public:
+  static ConstantPool& getInstance();
+
+  Literal* integer(long);
+  // an int literal, or a long one if n does not fit in a machine word
+  Literal* integer(const BigInt& n);
+  Literal* number(double);
+  Literal* string(const char* s, unsigned long n);
+  Literal* boolean(bool b) { return b ? trueLiteral : falseLiteral; }
+  Literal* none() { return noneLiteral; }
+  // the literal for any constant value; a string is copied if needed
+  Literal* literal(const Value&);
+
+  void printStats(std::ostream&) const;
+
+  ConstantPool(const ConstantPool&) = delete;
+  ConstantPool& operator=(const ConstantPool&) = delete;
+private:
+  ConstantPool();
+
+  // ints in [minSmall, maxSmall] are preallocated, as in CPython
+  static const long minSmall = -5;
+  static const long maxSmall = 256;
+  Literal* small[maxSmall - minSmall + 1];
+  Literal* trueLiteral;
+  Literal* falseLiteral;
+  Literal* noneLiteral;
+
+  std::unordered_map<long, Literal*> ints;
+  // keyed by bit pattern, so 0.0 and -0.0 stay apart
+  std::unordered_map<unsigned long long, Literal*> floats;
+  std::unordered_map<std::string, Literal*> strings;
+  // keyed by decimal spelling
+  std::unordered_map<std::string, Literal*> longs;
+
+  unsigned long lookups;  // literals asked for
+  unsigned long created;  // literals made beyond the preallocated ones
+};
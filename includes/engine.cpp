@@ -0,0 +1,23 @@
+#include "arena.h"
+#include "engine.h"
+#include "gc.h"
+#include "node.h"
+#include "profiler.h"
+#include "vm.h"
+
+Engine& Engine::getInstance() {
+  static thread_local Engine engine;
+  return engine;
+}
+
+Value Engine::execute(const Node* stmt) {
+  // temporaries of a statement are dropped as soon as it completes
+  ArenaScope statement(Scratch::getInstance());
+  Heap::getInstance().safepoint();
+  Profiler& profiler = Profiler::getInstance();
+  if (profiler.isEnabled()) profiler.statement(stmt);
+  if (kind == VM) {
+    return VirtualMachine::getInstance().execute(stmt);
+  }
+  return stmt->eval();
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "value.h"
+
+class Node;
+
+// Selects how top-level statements are executed: by walking the
+// AST (Node::eval) or by compiling them to bytecode for the VM.
+class Engine {
+public:
+  enum Kind { AST, VM };
+
+  static Engine& getInstance();
+  void setKind(Kind k) { kind = k; }
+  Kind getKind() const { return kind; }
+  Value execute(const Node*);
+
+  Engine(const Engine&) = delete;
+  Engine& operator=(const Engine&) = delete;
+private:
+  Engine() : kind(AST) {}
+  Kind kind;
+};
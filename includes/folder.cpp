@@ -0,0 +1,259 @@
+#include <iostream>
+#include "folder.h"
+#include "ast.h"
+#include "constants.h"
+#include "gc.h"
+
+namespace {
+
+// longest str result that is folded; a longer one ("-" * 100000) stays
+// an expression rather than a constant kept until exit
+const unsigned long maxFoldedString = 256;
+
+}
+
+Folder& Folder::getInstance() {
+  static thread_local Folder folder;
+  return folder;
+}
+
+Node* Folder::fold(Node* stmt) {
+  if (dump) {
+    std::cerr << "before: ";
+    stmt->dump(std::cerr);
+    std::cerr << std::endl;
+  }
+  stmt = stmt->fold(*this);
+  if (dump) {
+    std::cerr << "after:  ";
+    stmt->dump(std::cerr);
+    std::cerr << std::endl;
+  }
+  return stmt;
+}
+
+Node* Folder::evaluate(Node* expr) {
+  Value val;
+  try {
+    val = expr->eval();
+  }
+  catch (const std::string&) {
+    return expr;
+  }
+  if (val.getType() == Value::STR && val.getStr()->length() > maxFoldedString) {
+    return expr;
+  }
+  if (val.getType() == Value::LONG && val.getLong()->length() * sizeof(uint32_t) > maxFoldedString) {
+    return expr;
+  }
+  // a str or long result is young, the pool keeps a copy that is never swept
+  return ConstantPool::getInstance().literal(val);
+}
+
+bool Folder::isLiteral(const Node* n) {
+  return dynamic_cast<const Literal*>(n) != nullptr;
+}
+
+// Folding of the AST. Children are folded first, so a constant
+// expression collapses from the leaves up.
+
+Node* PrintNode::fold(Folder& f) {
+  node = f.foldChild(node);
+  return this;
+}
+
+Node* IfNode::fold(Folder& f) {
+  // a constant test still keeps both branches: names assigned in
+  // either one are locals of the enclosing function
+  comparison = f.foldChild(comparison);
+  ifBranch = f.foldChild(ifBranch);
+  elseBranch = f.foldChild(elseBranch);
+  return this;
+}
+
+Node* SuiteNode::fold(Folder& f) {
+  for (Node*& stmt : stmts) {
+    stmt = f.foldChild(stmt);
+  }
+  return this;
+}
+
+Node* FuncNode::fold(Folder& f) {
+  suite = f.foldChild(suite);
+  return this;
+}
+
+Node* ParamNode::fold(Folder& f) {
+  for (Node*& param : params) {
+    param = f.foldChild(param);
+  }
+  return this;
+}
+
+Node* CallNode::fold(Folder& f) {
+  arguments = f.foldChild(arguments);
+  return this;
+}
+
+Node* ReturnNode::fold(Folder& f) {
+  testlist = f.foldChild(testlist);
+  return this;
+}
+
+Node* UnaryNode::fold(Folder& f) {
+  node = f.foldChild(node);
+  return Folder::isLiteral(node) ? f.evaluate(this) : this;
+}
+
+Node* BinaryNode::fold(Folder& f) {
+  left = f.foldChild(left);
+  right = f.foldChild(right);
+  if (Folder::isLiteral(left) && Folder::isLiteral(right)) {
+    return f.evaluate(this);
+  }
+  return this;
+}
+
+Node* AsgBinaryNode::fold(Folder& f) {
+  // the target is a name, and for x += e it is shared with the operand
+  right = f.foldChild(right);
+  return this;
+}
+
+// Printing of the AST, for --dump-ast.
+
+namespace {
+
+void dumpChild(std::ostream& out, const Node* n) {
+  if (n) {
+    n->dump(out);
+  } else {
+    out << "null";
+  }
+}
+
+}
+
+void Node::dump(std::ostream& out) const {
+  out << "<node>";
+}
+
+void Literal::dump(std::ostream& out) const {
+  if (val.getType() != Value::STR) {
+    out << val.str();
+    return;
+  }
+  out << '\'';
+  for (const char* c = val.getStr()->chars(); *c; ++c) {
+    switch (*c) {
+      case '\n': out << "\\n"; break;
+      case '\t': out << "\\t"; break;
+      case '\\': out << "\\\\"; break;
+      case '\'': out << "\\'"; break;
+      default: out << *c;
+    }
+  }
+  out << '\'';
+}
+
+void IdentNode::dump(std::ostream& out) const {
+  out << ident->str();
+}
+
+void NullNode::dump(std::ostream& out) const {
+  out << "null";
+}
+
+void PrintNode::dump(std::ostream& out) const {
+  out << "(print";
+  if (node) {
+    out << ' ';
+    node->dump(out);
+  }
+  out << ')';
+}
+
+void IfNode::dump(std::ostream& out) const {
+  out << "(if ";
+  dumpChild(out, comparison);
+  out << ' ';
+  dumpChild(out, ifBranch);
+  if (elseBranch) {
+    out << ' ';
+    elseBranch->dump(out);
+  }
+  out << ')';
+}
+
+void SuiteNode::dump(std::ostream& out) const {
+  out << "(suite";
+  for (const Node* stmt : stmts) {
+    out << ' ';
+    dumpChild(out, stmt);
+  }
+  out << ')';
+}
+
+void FuncNode::dump(std::ostream& out) const {
+  out << "(def " << name->str() << ' ';
+  if (params) {
+    params->dump(out);
+  } else {
+    out << "()";
+  }
+  out << ' ';
+  dumpChild(out, suite);
+  out << ')';
+}
+
+void ParamNode::dump(std::ostream& out) const {
+  out << '(';
+  for (unsigned long i = 0; i < params.size(); ++i) {
+    if (i) out << ' ';
+    dumpChild(out, params[i]);
+  }
+  out << ')';
+}
+
+void CallNode::dump(std::ostream& out) const {
+  out << "(call " << funcName->str() << ' ';
+  dumpChild(out, arguments);
+  out << ')';
+}
+
+void ReturnNode::dump(std::ostream& out) const {
+  out << "(return";
+  if (testlist) {
+    out << ' ';
+    testlist->dump(out);
+  }
+  out << ')';
+}
+
+void UnaryNode::dump(std::ostream& out) const {
+  out << '(' << op << ' ';
+  dumpChild(out, node);
+  out << ')';
+}
+
+void BinaryNode::dumpOperands(std::ostream& out, const char* op) const {
+  out << '(' << op << ' ';
+  dumpChild(out, left);
+  out << ' ';
+  dumpChild(out, right);
+  out << ')';
+}
+
+void AsgBinaryNode::dump(std::ostream& out) const { dumpOperands(out, "="); }
+void AddBinaryNode::dump(std::ostream& out) const { dumpOperands(out, "+"); }
+void SubBinaryNode::dump(std::ostream& out) const { dumpOperands(out, "-"); }
+void MulBinaryNode::dump(std::ostream& out) const { dumpOperands(out, "*"); }
+void DivBinaryNode::dump(std::ostream& out) const { dumpOperands(out, "/"); }
+void IntDivBinaryNode::dump(std::ostream& out) const { dumpOperands(out, "//"); }
+void ModBinaryNode::dump(std::ostream& out) const { dumpOperands(out, "%"); }
+void ExpBinaryNode::dump(std::ostream& out) const { dumpOperands(out, "**"); }
+void LessBinaryNode::dump(std::ostream& out) const { dumpOperands(out, "<"); }
+void GreaterBinaryNode::dump(std::ostream& out) const { dumpOperands(out, ">"); }
+void EqualBinaryNode::dump(std::ostream& out) const { dumpOperands(out, "=="); }
+void GrtEqBinaryNode::dump(std::ostream& out) const { dumpOperands(out, ">="); }
+void LessEqBinaryNode::dump(std::ostream& out) const { dumpOperands(out, "<="); }
@@ -0,0 +1,33 @@
+#pragma once
+
+//  Constant folding. Every top-level statement goes through the folder
+//  before it is resolved: a subexpression whose operands are all
+//  literals is evaluated once, here, and replaced by a Literal holding
+//  its value. An expression that raises when evaluated (1/0) is left
+//  alone, so the error is still reported when and if it runs.
+
+#include <iosfwd>
+
+#include "node.h"
+
+class Folder {
+public:
+  static Folder& getInstance();
+
+  // the statement with its constant subexpressions folded
+  Node* fold(Node* stmt);
+  Node* foldChild(Node* n) { return n ? n->fold(*this) : n; }
+  // a Literal with the value of expr if it evaluates without error
+  Node* evaluate(Node* expr);
+
+  static bool isLiteral(const Node*);
+
+  // print every statement before and after folding
+  void setDump(bool d) { dump = d; }
+
+  Folder(const Folder&) = delete;
+  Folder& operator=(const Folder&) = delete;
+private:
+  Folder() : dump(false) {}
+  bool dump;
+};
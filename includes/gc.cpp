@@ -0,0 +1,160 @@
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include "gc.h"
+#include "tableManager.h"
+#include "vm.h"
+
+Heap& Heap::getInstance() {
+  static thread_local Heap heap;
+  return heap;
+}
+
+Heap::Heap() :
+  young(nullptr), old(nullptr), constants(nullptr),
+  youngBytes(0), oldBytes(0), threshold(1 << 20), oldLimit(4 << 20),
+  majorInProgress(false), roots(),
+  minorCollections(0), majorCollections(0),
+  bytesAllocated(0), bytesFreed(0), objectsFreed(0), peakBytes(0),
+  pauseTotal(0), pauseMax(0) {
+}
+
+Heap::~Heap() {
+  for (Object* list : {young, old, constants}) {
+    while (list) {
+      Object* next = list->next;
+      release(list);
+      list = next;
+    }
+  }
+}
+
+Object* Heap::allocate(unsigned long bytes) {
+  void* mem = ::operator new(bytes);
+  bytesAllocated += bytes;
+  return static_cast<Object*>(mem);
+}
+
+void Heap::release(Object* obj) {
+  ::operator delete(obj);
+}
+
+StrObject* Heap::newString(const char* s, unsigned long n) {
+  StrObject* str = new (allocate(sizeof(StrObject) + n + 1)) StrObject(n);
+  if (s) std::memcpy(str->data(), s, n);
+  str->data()[n] = '\0';
+  str->next = young;
+  young = str;
+  youngBytes += str->size;
+  if (youngBytes + oldBytes > peakBytes) peakBytes = youngBytes + oldBytes;
+  return str;
+}
+
+StrObject* Heap::constantString(const char* s, unsigned long n) {
+  StrObject* str = new (allocate(sizeof(StrObject) + n + 1)) StrObject(n);
+  std::memcpy(str->data(), s, n);
+  str->data()[n] = '\0';
+  // constants count as old so minor collections never look at them,
+  // and are on a list that is never swept
+  str->old = true;
+  str->next = constants;
+  constants = str;
+  return str;
+}
+
+LongObject* Heap::newLong(bool negative, const uint32_t* digits, unsigned long n) {
+  LongObject* num = new (allocate(sizeof(LongObject) + n * sizeof(uint32_t))) LongObject(negative, n);
+  std::memcpy(num->data(), digits, n * sizeof(uint32_t));
+  num->next = young;
+  young = num;
+  youngBytes += num->size;
+  if (youngBytes + oldBytes > peakBytes) peakBytes = youngBytes + oldBytes;
+  return num;
+}
+
+LongObject* Heap::constantLong(bool negative, const uint32_t* digits, unsigned long n) {
+  LongObject* num = new (allocate(sizeof(LongObject) + n * sizeof(uint32_t))) LongObject(negative, n);
+  std::memcpy(num->data(), digits, n * sizeof(uint32_t));
+  num->old = true;
+  num->next = constants;
+  constants = num;
+  return num;
+}
+
+void Heap::mark(Object* obj) {
+  if (obj->old && !majorInProgress) return;
+  obj->marked = true;
+}
+
+Object* Heap::sweep(Object* list, unsigned long& bytes) {
+  Object* survivors = nullptr;
+  while (list) {
+    Object* next = list->next;
+    if (list->marked) {
+      list->marked = false;
+      list->next = survivors;
+      survivors = list;
+    } else {
+      bytes -= list->size;
+      bytesFreed += list->size;
+      ++objectsFreed;
+      release(list);
+    }
+    list = next;
+  }
+  return survivors;
+}
+
+void Heap::collect(bool major) {
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  majorInProgress = major;
+
+  TableManager::getInstance().markRoots(*this);
+  VirtualMachine::getInstance().markRoots(*this);
+  for (const std::pair<const Value*, unsigned long>& root : roots) {
+    for (unsigned long i = 0; i < root.second; ++i) {
+      mark(root.first[i]);
+    }
+  }
+
+  Object* survivors = sweep(young, youngBytes);
+  young = nullptr;
+  if (major) {
+    old = sweep(old, oldBytes);
+    ++majorCollections;
+  } else {
+    ++minorCollections;
+  }
+  // everything that survived a collection is promoted
+  while (survivors) {
+    Object* next = survivors->next;
+    survivors->old = true;
+    survivors->next = old;
+    old = survivors;
+    oldBytes += survivors->size;
+    survivors = next;
+  }
+  youngBytes = 0;
+  if (major) {
+    oldLimit = oldBytes * 2 > 4 * threshold ? oldBytes * 2 : 4 * threshold;
+  }
+  majorInProgress = false;
+
+  std::chrono::duration<double, std::milli> pause = std::chrono::steady_clock::now() - start;
+  pauseTotal += pause.count();
+  if (pause.count() > pauseMax) pauseMax = pause.count();
+}
+
+void Heap::printStats(std::ostream& out) const {
+  out << "gc: " << minorCollections << " minor, " << majorCollections
+      << " major collections (threshold " << threshold << " bytes)" << std::endl;
+  out << std::fixed << std::setprecision(3)
+      << "gc: pause total " << pauseTotal << " ms, max " << pauseMax << " ms" << std::endl;
+  out.unsetf(std::ios_base::floatfield);
+  out << "gc: allocated " << bytesAllocated << " bytes, freed " << bytesFreed
+      << " bytes in " << objectsFreed << " objects" << std::endl;
+  out << "gc: live " << youngBytes + oldBytes << " bytes (young " << youngBytes
+      << ", old " << oldBytes << "), peak " << peakBytes << " bytes" << std::endl;
+}
@@ -0,0 +1,141 @@
+#pragma once
+
+//  Precise mark-and-sweep collector for the values that do not fit
+//  inline in a Value. Objects start out young; a minor collection
+//  sweeps only the young generation and promotes what survives, a
+//  major collection sweeps everything. No heap object refers to
+//  another one yet, so an old object can never keep a young one
+//  alive and minor collections need no write barrier.
+//
+//  Collections only run at safepoints: before each top-level
+//  statement and on entry to each call. Allocation itself never
+//  collects, so a Value only has to be rooted if it is held in a C++
+//  local while a call may run (see Root below).
+
+#include <cstdint>
+#include <iosfwd>
+#include <utility>
+#include <vector>
+#include "value.h"
+
+class Heap;
+
+class Object {
+public:
+  enum Kind { STRING, LONG };
+  Kind getKind() const { return kind; }
+  Object(const Object&) = delete;
+  Object& operator=(const Object&) = delete;
+protected:
+  Object(Kind k, unsigned long s) : next(nullptr), size(s), kind(k), marked(false), old(false) {}
+  ~Object() {}
+private:
+  friend class Heap;
+  Object* next;
+  unsigned long size;  // bytes, including the header
+  Kind kind;
+  bool marked;
+  bool old;
+};
+
+// characters are stored right after the object, NUL terminated
+class StrObject : public Object {
+public:
+  unsigned long length() const { return len; }
+  const char* chars() const { return reinterpret_cast<const char*>(this + 1); }
+  char* data() { return reinterpret_cast<char*>(this + 1); }
+private:
+  friend class Heap;
+  explicit StrObject(unsigned long n) : Object(STRING, sizeof(StrObject) + n + 1), len(n) {}
+  unsigned long len;
+};
+
+// a long (bigint.h): base 2**32 digits stored right after the object,
+// least significant first
+class LongObject : public Object {
+public:
+  bool isNegative() const { return negative; }
+  unsigned long length() const { return len; }
+  const uint32_t* digits() const { return reinterpret_cast<const uint32_t*>(this + 1); }
+  uint32_t* data() { return reinterpret_cast<uint32_t*>(this + 1); }
+private:
+  friend class Heap;
+  LongObject(bool neg, unsigned long n) :
+    Object(LONG, sizeof(LongObject) + n * sizeof(uint32_t)), negative(neg), len(n) {}
+  bool negative;
+  unsigned long len;
+};
+
+class Heap {
+public:
+  static Heap& getInstance();
+  ~Heap();
+
+  // a collectable string of n characters, copied from s when given
+  StrObject* newString(const char* s, unsigned long n);
+  // a string that lives until exit, for constants in the program text
+  StrObject* constantString(const char* s, unsigned long n);
+  // a collectable long, and one for constants
+  LongObject* newLong(bool negative, const uint32_t* digits, unsigned long n);
+  LongObject* constantLong(bool negative, const uint32_t* digits, unsigned long n);
+
+  void safepoint() {
+    if (youngBytes >= threshold) collect(oldBytes >= oldLimit);
+  }
+  void collect(bool major);
+  void mark(const Value& v) {
+    if (v.isObject()) mark(v.getObject());
+  }
+  void mark(Object*);
+
+  void setThreshold(unsigned long bytes) {
+    threshold = bytes;
+    oldLimit = 4 * bytes;
+  }
+  unsigned long getBytesAllocated() const { return bytesAllocated; }
+  void printStats(std::ostream&) const;
+
+  void pushRoot(const Value* vals, unsigned long n) { roots.push_back(std::make_pair(vals, n)); }
+  void popRoot() { roots.pop_back(); }
+
+  Heap(const Heap&) = delete;
+  Heap& operator=(const Heap&) = delete;
+
+private:
+  Heap();
+  Object* allocate(unsigned long bytes);
+  static void release(Object*);
+  // frees the unmarked objects of a list, returns what survived
+  Object* sweep(Object* list, unsigned long& bytes);
+
+  Object* young;
+  Object* old;
+  Object* constants;
+  unsigned long youngBytes;
+  unsigned long oldBytes;
+  unsigned long threshold;  // young bytes that trigger a collection
+  unsigned long oldLimit;   // old bytes that turn the next collection into a major one
+  bool majorInProgress;
+
+  // Values held by native code, see Root
+  std::vector<std::pair<const Value*, unsigned long> > roots;
+
+  unsigned long minorCollections;
+  unsigned long majorCollections;
+  unsigned long bytesAllocated;
+  unsigned long bytesFreed;
+  unsigned long objectsFreed;
+  unsigned long peakBytes;
+  double pauseTotal;  // milliseconds
+  double pauseMax;
+};
+
+// Keeps Values held in a C++ local reachable until the end of the scope.
+class Root {
+public:
+  explicit Root(const Value& v) { Heap::getInstance().pushRoot(&v, 1); }
+  Root(const Value* vals, unsigned long n) { Heap::getInstance().pushRoot(vals, n); }
+  ~Root() { Heap::getInstance().popRoot(); }
+  Root(const Root&) = delete;
+  Root& operator=(const Root&) = delete;
+};
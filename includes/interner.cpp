@@ -0,0 +1,48 @@
+#include <cstring>
+#include "interner.h"
+
+Interner& Interner::getInstance() {
+  static thread_local Interner interner;
+  return interner;
+}
+
+Interner::Interner() : atoms("atoms", 16 * 1024), table(256, nullptr), count(0) {
+}
+
+// FNV-1a
+unsigned long Interner::hash(const char* s, unsigned long n) {
+  unsigned long h = 14695981039346656037UL;
+  for (unsigned long i = 0; i < n; ++i) {
+    h ^= static_cast<unsigned char>(s[i]);
+    h *= 1099511628211UL;
+  }
+  return h;
+}
+
+const Atom* Interner::intern(const char* s, unsigned long n) {
+  const unsigned long h = hash(s, n);
+  const unsigned long mask = table.size() - 1;
+  unsigned long i = h & mask;
+  while (const Atom* atom = table[i]) {
+    if (atom->hash() == h && atom->str().size() == n && std::memcmp(atom->str().data(), s, n) == 0) {
+      return atom;
+    }
+    i = (i + 1) & mask;
+  }
+  const Atom* atom = atoms.make<Atom>(s, n, h);
+  table[i] = atom;
+  if (++count * 2 > table.size()) grow();
+  return atom;
+}
+
+void Interner::grow() {
+  std::vector<const Atom*> old(table.size() * 2, nullptr);
+  old.swap(table);
+  const unsigned long mask = table.size() - 1;
+  for (const Atom* atom : old) {
+    if (!atom) continue;
+    unsigned long i = atom->hash() & mask;
+    while (table[i]) i = (i + 1) & mask;
+    table[i] = atom;
+  }
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+//  Identifiers are interned as they are scanned: every spelling maps
+//  to one Atom that lives until exit, so names compare by pointer and
+//  carry a precomputed hash.
+
+#include <string>
+#include <vector>
+#include "arena.h"
+
+class Atom {
+public:
+  Atom(const char* s, unsigned long n, unsigned long h) : text(s, n), code(h) {}
+  const std::string& str() const { return text; }
+  unsigned long hash() const { return code; }
+  Atom(const Atom&) = delete;
+  Atom& operator=(const Atom&) = delete;
+private:
+  const std::string text;
+  const unsigned long code;
+};
+
+class Interner {
+public:
+  static Interner& getInstance();
+  const Atom* intern(const char* s, unsigned long n);
+  const Atom* intern(const std::string& s) { return intern(s.data(), s.size()); }
+  unsigned long size() const { return count; }
+  Interner(const Interner&) = delete;
+  Interner& operator=(const Interner&) = delete;
+private:
+  Interner();
+  void grow();
+  static unsigned long hash(const char* s, unsigned long n);
+
+  Arena atoms;
+  // open addressing with linear probing, a power of two in size
+  std::vector<const Atom*> table;
+  unsigned long count;
+};
@@ -0,0 +1,153 @@
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <unistd.h>
+#include "interpreter.h"
+#include "ast.h"
+#include "constants.h"
+#include "engine.h"
+#include "folder.h"
+#include "gc.h"
+#include "jit.h"
+#include "memo.h"
+#include "parser.h"
+#include "profiler.h"
+#include "programCache.h"
+#include "quicken.h"
+#include "source.h"
+#include "tableManager.h"
+#include "vm.h"
+
+Interpreter& Interpreter::getInstance() {
+  static thread_local Interpreter interpreter;
+  return interpreter;
+}
+
+Interpreter::Interpreter() : options(), writer(), output(&writer), errors(&std::cerr) {}
+
+void Interpreter::configure(const Options& opts) {
+  options = opts;
+  Engine::getInstance().setKind(options.vm ? Engine::VM : Engine::AST);
+  if (options.jitThreshold >= 0) {
+    // native code is made from bytecode
+    Jit::getInstance().setThreshold(options.jitThreshold);
+    Engine::getInstance().setKind(Engine::VM);
+  }
+  else {
+    Jit::getInstance().disable();
+  }
+  if (options.gcThreshold) Heap::getInstance().setThreshold(options.gcThreshold);
+  if (options.recursionLimit) TableManager::getInstance().setRecursionLimit(options.recursionLimit);
+  if (options.memoEntries) Memo::getInstance().setCapacity(options.memoEntries);
+  if (options.warmup >= 0) Quickening::getInstance().setWarmup(options.warmup);
+  Folder::getInstance().setDump(options.dumpAst);
+  writer.setLineBuffered(options.lineBuffered && isatty(STDOUT_FILENO));
+}
+
+int Interpreter::run(const char* filename) {
+  FILE* file = filename ? std::fopen(filename, "r") : stdin;
+  if (!file) {
+    *errors << "Could not open file \"" << filename << "\"" << std::endl;
+    return EXIT_FAILURE;
+  }
+  Source source;
+  const bool read = source.open(file, options.mapInput);
+  std::fclose(file);
+  if (!read) {
+    *errors << "Could not read \"" << (filename ? filename : "<stdin>") << "\"" << std::endl;
+    return EXIT_FAILURE;
+  }
+  Profiler& profiler = Profiler::getInstance();
+  if (filename && profiler.isEnabled()) {
+    profiler.setSource(std::string(source.data(), source.size()));
+  }
+  ProgramCache& cache = ProgramCache::getInstance();
+  // the dump is made while parsing, and lines are recorded then
+  if (filename && options.useCache && !options.dumpAst && !profiler.isEnabled()) {
+    cache.open(filename, source.data(), source.size());
+  }
+
+  const int status = guard([&]() {
+    std::vector<Node*> stmts;
+    if (cache.isOpen() && cache.load(stmts)) {
+      runStatements(stmts);
+      return true;
+    }
+    if (!parse(source, stmts)) return false;
+    runStatements(stmts);
+    cache.save();
+    return true;
+  });
+  // what is parsed later, from text or another file, is no part of it
+  cache.close();
+  return status;
+}
+
+int Interpreter::compile(const char* text, unsigned long size, std::vector<Node*>& stmts) {
+  Source source;
+  if (!source.open(text, size)) {
+    *errors << "Could not copy the source" << std::endl;
+    return EXIT_FAILURE;
+  }
+  return guard([&]() { return parse(source, stmts); });
+}
+
+int Interpreter::execute(const std::vector<Node*>& stmts) {
+  return guard([&]() {
+    runStatements(stmts);
+    return true;
+  });
+}
+
+int Interpreter::guard(const std::function<bool()>& step) {
+  int status = EXIT_FAILURE;
+  const unsigned long profiled = Profiler::getInstance().depth();
+  try {
+    status = step() ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+  catch (const std::string& msg) {
+    output << msg << '\n';
+    unwind(profiled);
+  }
+  catch (...) {
+    output << "Uncaught exception: " << '\n';
+    unwind(profiled);
+  }
+  writer.flush();
+  return status;
+}
+
+// the calls guards unwind are gone already; this makes sure the next
+// run starts at the top level whatever the error went through
+void Interpreter::unwind(unsigned long profiled) {
+  TableManager::getInstance().unwindTo(0);
+  VirtualMachine::getInstance().reset();
+  Profiler::getInstance().unwindTo(profiled);
+}
+
+bool Interpreter::parse(Source& source, std::vector<Node*>& stmts) {
+  ParseContext context{PoolOfNodes::getInstance(), ConstantPool::getInstance(), stmts};
+  yyscan_t scanner = init_scanner(source);
+  int status;
+  try {
+    status = yyparse(scanner, context);
+  }
+  catch (const ScanError&) {
+    status = 1;
+  }
+  catch (...) {
+    end_scanner(scanner);
+    throw;
+  }
+  end_scanner(scanner);
+  return status == 0;
+}
+
+void Interpreter::runStatements(const std::vector<Node*>& stmts) {
+  for (Node* stmt : stmts) {
+    Resolver::getInstance().resolve(stmt);
+    Engine::getInstance().execute(stmt);
+  }
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+//  The interpreter a script runs in. Everything a script changes, from
+//  the interner and the node pool to the scope stack, the heap and the
+//  VM, is a thread-local singleton, so each thread is an interpreter of
+//  its own and scripts on different threads share nothing they change.
+//  Interpreter::getInstance() is the calling thread's: it applies the
+//  options, holds where print and errors write, and runs scripts.
+//
+//  A script is parsed whole and then run, as Python does. Whatever a
+//  script defines stays for the next one run on the same thread, and
+//  so do the nodes it was parsed into, until the thread ends.
+
+#include <functional>
+#include <ostream>
+#include <vector>
+#include "writer.h"
+
+class Node;
+class Source;
+
+class Interpreter {
+public:
+  struct Options {
+    bool vm;
+    long jitThreshold;         // calls before compiling, or -1 for no JIT
+    unsigned long gcThreshold; // 0 for the heap's own
+    unsigned long recursionLimit;
+    unsigned long memoEntries; // 0 for no memoization
+    long warmup;               // -1 for the quickener's own
+    bool dumpAst;
+    bool useCache;
+    bool mapInput;
+    bool lineBuffered;         // when standard output is a terminal
+    Options() : vm(false), jitThreshold(-1), gcThreshold(0), recursionLimit(0),
+      memoEntries(0), warmup(-1), dumpAst(false), useCache(true), mapInput(true),
+      lineBuffered(false) {}
+  };
+
+  static Interpreter& getInstance();
+
+  // sets up this thread's interpreter; call before the first run
+  void configure(const Options&);
+  // what print writes, standard output unless set, through a buffer
+  // that is flushed when a run is done; run-time errors go here too
+  std::ostream& getOutput() { return output; }
+  Writer& getWriter() { return writer; }
+  void setOutput(std::ostream& out) { writer.setSink(out); }
+  // where syntax errors are reported, std::cerr unless set
+  std::ostream& getErrors() const { return *errors; }
+  void setErrors(std::ostream& err) { errors = &err; }
+
+  // the following return an exit status
+  // parses and runs the script in filename, or stdin if it is null
+  int run(const char* filename);
+  // parses text into stmts, to be run by execute, any number of times
+  int compile(const char* text, unsigned long size, std::vector<Node*>& stmts);
+  int execute(const std::vector<Node*>& stmts);
+
+  Interpreter(const Interpreter&) = delete;
+  Interpreter& operator=(const Interpreter&) = delete;
+private:
+  Interpreter();
+  // runs step, turning an error it throws into a message and a failure
+  int guard(const std::function<bool()>& step);
+  void unwind(unsigned long profiled);
+  bool parse(Source&, std::vector<Node*>& stmts);
+  void runStatements(const std::vector<Node*>&);
+
+  Options options;
+  Writer writer;
+  std::ostream output;
+  std::ostream* errors;
+};
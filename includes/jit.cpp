@@ -0,0 +1,620 @@
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iostream>
+#include <utility>
+#include "jit.h"
+#include "ast.h"
+#include "interpreter.h"
+#include "memo.h"
+#include "vm.h"
+
+#if defined(__x86_64__) && defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#define MYPY_JIT 1
+#endif
+
+Jit& Jit::getInstance() {
+  static thread_local Jit jit;
+  return jit;
+}
+
+Jit::~Jit() {
+#ifdef MYPY_JIT
+  for (const std::pair<void*, unsigned long>& buffer : buffers) {
+    munmap(buffer.first, buffer.second);
+  }
+#endif
+}
+
+Jit::Status Jit::run(NativeCode native, JitFrame& frame) {
+  ++depth;
+  ++nativeRuns;
+  const Status status = static_cast<Status>(native(&frame));
+  --depth;
+  if (status == BAILOUT) {
+    ++bailouts;
+    JitState& state = frame.code->jit;
+    if (++state.bailouts > maxBailouts && state.native) {
+      state.native = nullptr;
+      state.rejected = true;
+      ++abandoned;
+    }
+  }
+  return status;
+}
+
+void Jit::rethrow() {
+  std::exception_ptr err = error;
+  error = nullptr;
+  std::rethrow_exception(err);
+}
+
+void Jit::printStats(std::ostream& out) const {
+  out << "jit: " << compiled << " bodies compiled to " << codeBytes << " bytes, "
+      << rejected << " rejected, threshold " << threshold << " calls" << std::endl;
+  out << "jit: " << nativeRuns << " native runs, " << bailouts << " bailouts, "
+      << abandoned << " bodies back to the interpreter" << std::endl;
+}
+
+#ifdef MYPY_JIT
+
+namespace {
+
+// Helpers called from native code. They run an instruction the way the
+// VM would, on the operand stack at depth, and return CONTINUE, or
+// FAILED with the error kept by the Jit.
+
+Value* operands(JitFrame* f, int depth) {
+  return f->stack + depth;
+}
+
+int failed() {
+  Jit::getInstance().fail(std::current_exception());
+  return Jit::FAILED;
+}
+
+int binaryHelper(JitFrame* f, int op, int depth) {
+  try {
+    Value* sp = operands(f, depth);
+    sp[-2] = Value::binary(static_cast<Value::Op>(op), sp[-2], sp[-1]);
+    return Jit::CONTINUE;
+  }
+  catch (...) {
+    return failed();
+  }
+}
+
+int unaryHelper(JitFrame* f, int op, int depth) {
+  try {
+    Value* sp = operands(f, depth);
+    sp[-1] = sp[-1].unary(static_cast<char>(op));
+    return Jit::CONTINUE;
+  }
+  catch (...) {
+    return failed();
+  }
+}
+
+int printItemHelper(JitFrame* f, int, int depth) {
+  try {
+    operands(f, depth)[-1].print();
+    return Jit::CONTINUE;
+  }
+  catch (...) {
+    return failed();
+  }
+}
+
+int printNewlineHelper(JitFrame*, int, int) {
+  try {
+    Interpreter::getInstance().getWriter().newline();
+    return Jit::CONTINUE;
+  }
+  catch (...) {
+    return failed();
+  }
+}
+
+int loadEnclosingHelper(JitFrame* f, int index, int depth) {
+  try {
+    const Variable& var = f->code->variables[index];
+    const Value& val = TableManager::getInstance().getEnclosing(var.loc.depth, var.loc.slot);
+    if (val.isUndefined()) {
+      IdentNode::unbound(var.name->str(), var.loc);
+    }
+    operands(f, depth)[0] = val;
+    return Jit::CONTINUE;
+  }
+  catch (...) {
+    return failed();
+  }
+}
+
+int makeFunctionHelper(JitFrame* f, int index, int) {
+  try {
+    const FuncNode* func = f->code->functions[index];
+    TableManager::getInstance().setFunc(func->getName(), func);
+    return Jit::CONTINUE;
+  }
+  catch (...) {
+    return failed();
+  }
+}
+
+int callHelper(JitFrame* f, int index, int depth) {
+  try {
+    TableManager& tm = TableManager::getInstance();
+    Memo& memo = Memo::getInstance();
+    VirtualMachine& vm = VirtualMachine::getInstance();
+    const CallSite& site = f->code->calls[index];
+    Value* args = operands(f, depth) - site.argc;
+    SymbolTable* scope = nullptr;
+    const FuncNode* func = tm.getFunc(site.name, &scope, site.cache);
+    CallNode::checkArguments(site.name->str(), func->getParams().size(), site.argc);
+    const bool memoized = memo.applies(func, args, site.argc);
+    Value result;
+    if (!memoized || !memo.find(func, args, site.argc, result)) {
+      result = vm.call(func, scope, args, site.argc);
+      // the callee may have grown the operand stack
+      f->stack = vm.stackAt(f->base);
+      f->globals = tm.getGlobals();
+      args = operands(f, depth) - site.argc;
+      if (memoized) memo.store(func, args, site.argc, result);
+    }
+    *args = result;
+    return Jit::CONTINUE;
+  }
+  catch (...) {
+    return failed();
+  }
+}
+
+typedef int (*Helper)(JitFrame*, int, int);
+
+}
+
+// Emits x86-64 machine code for one code object. Registers:
+//   rbx  the JitFrame
+//   r12  the code object's operand stack
+//   r13  the frame's slots
+//   r14  the globals
+// Values stay in memory; rax, rcx and xmm0 hold temporaries.
+class JitCompiler {
+public:
+  explicit JitCompiler(const Code& c) :
+    code(c), buf(), depths(c.instructions.size() + 1, -1), labels(c.instructions.size() + 1, 0),
+    jumps(), bailouts(), exits() {}
+
+  // false if the code cannot be compiled
+  bool compile();
+  const std::vector<unsigned char>& getCode() const { return buf; }
+
+  JitCompiler(const JitCompiler&) = delete;
+  JitCompiler& operator=(const JitCompiler&) = delete;
+private:
+  enum Reg { RAX = 0, RCX = 1, RDX = 2, RBX = 3, RSP = 4, RBP = 5, RSI = 6, RDI = 7,
+             R12 = 12, R13 = 13, R14 = 14 };
+  enum Cond { O = 0x0, E = 0x4, NE = 0x5, NP = 0xb, L = 0xc, GE = 0xd, LE = 0xe, G = 0xf,
+              A = 0x7, AE = 0x3 };
+
+  static const int typeOffset = offsetof(Value, type);
+  static const int payloadOffset = offsetof(Value, i);
+
+  // the operand stack depth before each instruction, -1 if unreachable
+  bool computeDepths();
+  void emitInstruction(int at, const Instruction&, int depth);
+  void emitArithmetic(int at, Opcode, int depth);
+  void emitCompare(int at, Opcode, int depth);
+  void emitHelper(Helper, int arg, int depth);
+
+  // the operand at depth d of the stack
+  static int slot(int d) { return d * static_cast<int>(sizeof(Value)); }
+
+  void byte(unsigned char b) { buf.push_back(b); }
+  void dword(int v) {
+    for (int k = 0; k < 4; ++k) byte(static_cast<unsigned char>(v >> (8 * k)));
+  }
+  void qword(unsigned long v) {
+    for (int k = 0; k < 8; ++k) byte(static_cast<unsigned char>(v >> (8 * k)));
+  }
+  // [prefix] REX opcode modrm: an instruction with a [base + disp32] operand
+  void mem(int prefix, bool wide, std::initializer_list<unsigned char> opcode, int reg, int base, int disp);
+  void load(int reg, int base, int disp) { mem(0, true, {0x8b}, reg, base, disp); }
+  void store(int base, int disp, int reg) { mem(0, true, {0x89}, reg, base, disp); }
+  void copy(int toBase, int toDisp, int fromBase, int fromDisp) {
+    mem(0xf3, false, {0x0f, 0x6f}, 0, fromBase, fromDisp);  // movdqu xmm0, from
+    mem(0xf3, false, {0x0f, 0x7f}, 0, toBase, toDisp);      // movdqu to, xmm0
+  }
+  void cmpType(int base, int disp, Value::Type t) {
+    mem(0, false, {0x83}, 7, base, disp + typeOffset);
+    byte(t);
+  }
+  void setType(int base, int disp, Value::Type t) {
+    mem(0, false, {0xc7}, 0, base, disp + typeOffset);
+    dword(t);
+  }
+  void movImm(int reg, unsigned long v) {
+    byte(0x48 | (reg >= 8));
+    byte(0xb8 + (reg & 7));
+    qword(v);
+  }
+  void movImm32(int reg, int v) {
+    byte(0xb8 + reg);
+    dword(v);
+  }
+  // a jump to be patched later, returns where its rel32 is
+  int jcc(Cond c) {
+    byte(0x0f);
+    byte(0x80 + c);
+    dword(0);
+    return buf.size() - 4;
+  }
+  int jmp() {
+    byte(0xe9);
+    dword(0);
+    return buf.size() - 4;
+  }
+  void patch(int rel, int target) {
+    const int off = target - (rel + 4);
+    std::memcpy(&buf[rel], &off, sizeof(off));
+  }
+  int here() const { return buf.size(); }
+  // a guard failure: hand over to the VM before instruction at
+  void bailout(int rel, int at, int depth) { bailouts.push_back(Exit{rel, at, depth}); }
+
+  struct Exit {
+    int rel;
+    int at;
+    int depth;
+  };
+
+  const Code& code;
+  std::vector<unsigned char> buf;
+  std::vector<int> depths;
+  std::vector<int> labels;
+  // jumps to instructions, and to the epilogue
+  std::vector<std::pair<int, int> > jumps;
+  std::vector<Exit> bailouts;
+  std::vector<int> exits;
+};
+
+void JitCompiler::mem(int prefix, bool wide, std::initializer_list<unsigned char> opcode, int reg, int base, int disp) {
+  if (prefix) byte(prefix);
+  const unsigned char rex = 0x40 | (wide << 3) | ((reg >= 8) << 2) | (base >= 8);
+  if (rex != 0x40) byte(rex);
+  for (unsigned char op : opcode) byte(op);
+  byte(0x80 | ((reg & 7) << 3) | (base & 7));
+  if ((base & 7) == RSP) byte(0x24);
+  dword(disp);
+}
+
+bool JitCompiler::computeDepths() {
+  const int n = code.instructions.size();
+  std::vector<int> work(1, 0);
+  depths[0] = 0;
+  while (!work.empty()) {
+    int at = work.back();
+    work.pop_back();
+    int depth = depths[at];
+    for (;;) {
+      const Instruction& ins = code.instructions[at];
+      int next = depth;
+      bool falls = true;
+      switch (ins.op) {
+        case LOAD_CONST: case LOAD_LOCAL: case LOAD_ENCLOSING: case LOAD_GLOBAL: case DUP_TOP:
+          ++next; break;
+        case STORE_LOCAL: case STORE_GLOBAL: case POP_TOP: case PRINT_ITEM:
+        case BINARY_ADD: case BINARY_SUB: case BINARY_MUL: case BINARY_DIV:
+        case BINARY_INT_DIV: case BINARY_MOD: case BINARY_POW:
+        case COMPARE_LT: case COMPARE_GT: case COMPARE_EQ: case COMPARE_GE: case COMPARE_LE:
+          --next; break;
+        case CALL_FUNCTION:
+          next += 1 - code.calls[ins.arg].argc; break;
+        case JUMP_IF_FALSE:
+        case JUMP: {
+          if (ins.op == JUMP_IF_FALSE) --next;
+          falls = ins.op != JUMP;
+          if (ins.arg < 0 || ins.arg >= n) return false;
+          if (depths[ins.arg] < 0) {
+            depths[ins.arg] = next;
+            work.push_back(ins.arg);
+          } else if (depths[ins.arg] != next) {
+            return false;
+          }
+          break;
+        }
+        case RETURN_VALUE: case RETURN_NONE:
+          falls = false; break;
+        default:
+          break;
+      }
+      if (next < 0 || next > code.maxStack) return false;
+      if (!falls || ++at >= n) break;
+      if (depths[at] >= 0) {
+        if (depths[at] != next) return false;
+        break;
+      }
+      depths[at] = depth = next;
+    }
+  }
+  return true;
+}
+
+bool JitCompiler::compile() {
+  if (code.instructions.empty() || code.instructions.back().op != RETURN_NONE) return false;
+  if (!computeDepths()) return false;
+
+  // prologue: five pushes keep the C stack 16-byte aligned for calls
+  byte(0x55);                                    // push rbp
+  byte(0x53);                                    // push rbx
+  byte(0x41); byte(0x54);                        // push r12
+  byte(0x41); byte(0x55);                        // push r13
+  byte(0x41); byte(0x56);                        // push r14
+  byte(0x48); byte(0x89); byte(0xfb);            // mov rbx, rdi
+  load(R12, RBX, offsetof(JitFrame, stack));
+  load(R13, RBX, offsetof(JitFrame, locals));
+  load(R14, RBX, offsetof(JitFrame, globals));
+
+  for (unsigned long at = 0; at < code.instructions.size(); ++at) {
+    labels[at] = here();
+    if (depths[at] >= 0) emitInstruction(at, code.instructions[at], depths[at]);
+  }
+  labels[code.instructions.size()] = here();
+
+  // bailouts record where the VM takes over
+  for (const Exit& exit : bailouts) {
+    patch(exit.rel, here());
+    mem(0, false, {0xc7}, 0, RBX, offsetof(JitFrame, pc));
+    dword(exit.at);
+    mem(0, false, {0xc7}, 0, RBX, offsetof(JitFrame, sp));
+    dword(exit.depth);
+    movImm32(RAX, Jit::BAILOUT);
+    exits.push_back(jmp());
+  }
+
+  // epilogue, the status is in eax
+  const int epilogue = here();
+  byte(0x41); byte(0x5e);                        // pop r14
+  byte(0x41); byte(0x5d);                        // pop r13
+  byte(0x41); byte(0x5c);                        // pop r12
+  byte(0x5b);                                    // pop rbx
+  byte(0x5d);                                    // pop rbp
+  byte(0xc3);                                    // ret
+
+  for (const std::pair<int, int>& jump : jumps) {
+    patch(jump.first, labels[jump.second]);
+  }
+  for (int rel : exits) {
+    patch(rel, epilogue);
+  }
+  return true;
+}
+
+void JitCompiler::emitHelper(Helper fn, int arg, int depth) {
+  byte(0x48); byte(0x89); byte(0xdf);            // mov rdi, rbx
+  movImm32(RSI, arg);
+  movImm32(RDX, depth);
+  movImm(RAX, reinterpret_cast<unsigned long>(fn));
+  byte(0xff); byte(0xd0);                        // call rax
+  byte(0x85); byte(0xc0);                        // test eax, eax
+  exits.push_back(jcc(NE));
+}
+
+void JitCompiler::emitInstruction(int at, const Instruction& ins, int depth) {
+  const int top = slot(depth - 1);
+  switch (ins.op) {
+    case LOAD_CONST: {
+      unsigned long words[2];
+      static_assert(sizeof(words) == sizeof(Value), "a Value is two words");
+      std::memcpy(words, &code.constants[ins.arg], sizeof(words));
+      movImm(RAX, words[0]);
+      store(R12, slot(depth), RAX);
+      movImm(RAX, words[1]);
+      store(R12, slot(depth) + 8, RAX);
+      break;
+    }
+    case LOAD_LOCAL:
+      cmpType(R13, slot(ins.arg), Value::UNDEF);
+      bailout(jcc(E), at, depth);
+      copy(R12, slot(depth), R13, slot(ins.arg));
+      break;
+    case STORE_LOCAL:
+      copy(R13, slot(ins.arg), R12, top);
+      break;
+    case LOAD_GLOBAL:
+      cmpType(R14, slot(ins.arg), Value::UNDEF);
+      bailout(jcc(E), at, depth);
+      copy(R12, slot(depth), R14, slot(ins.arg));
+      break;
+    case STORE_GLOBAL:
+      copy(R14, slot(ins.arg), R12, top);
+      break;
+    case LOAD_ENCLOSING:
+      emitHelper(loadEnclosingHelper, ins.arg, depth);
+      break;
+    case BINARY_ADD: case BINARY_SUB: case BINARY_MUL:
+      emitArithmetic(at, ins.op, depth);
+      break;
+    case BINARY_DIV: case BINARY_INT_DIV: case BINARY_MOD: case BINARY_POW:
+      emitHelper(binaryHelper, Value::ADD + (ins.op - BINARY_ADD), depth);
+      break;
+    case COMPARE_LT: case COMPARE_GT: case COMPARE_EQ: case COMPARE_GE: case COMPARE_LE:
+      emitCompare(at, ins.op, depth);
+      break;
+    case UNARY_OP:
+      emitHelper(unaryHelper, ins.arg, depth);
+      break;
+    case PRINT_ITEM:
+      emitHelper(printItemHelper, 0, depth);
+      break;
+    case PRINT_NEWLINE:
+      emitHelper(printNewlineHelper, 0, depth);
+      break;
+    case POP_TOP:
+      break;
+    case DUP_TOP:
+      copy(R12, slot(depth), R12, top);
+      break;
+    case JUMP:
+      jumps.push_back(std::make_pair(jmp(), ins.arg));
+      break;
+    case JUMP_IF_FALSE: {
+      // bools and ints are tested inline, anything else is left to the VM
+      cmpType(R12, top, Value::BOOL);
+      const int notBool = jcc(NE);
+      mem(0, false, {0x80}, 7, R12, top + payloadOffset);  // cmp byte, 0
+      byte(0);
+      jumps.push_back(std::make_pair(jcc(E), ins.arg));
+      const int done = jmp();
+      patch(notBool, here());
+      cmpType(R12, top, Value::INT);
+      bailout(jcc(NE), at, depth);
+      mem(0, true, {0x83}, 7, R12, top + payloadOffset);   // cmp qword, 0
+      byte(0);
+      jumps.push_back(std::make_pair(jcc(E), ins.arg));
+      patch(done, here());
+      break;
+    }
+    case MAKE_FUNCTION:
+      emitHelper(makeFunctionHelper, ins.arg, depth);
+      break;
+    case CALL_FUNCTION:
+      emitHelper(callHelper, ins.arg, depth);
+      // the call may have moved the operand stack and the globals
+      load(R12, RBX, offsetof(JitFrame, stack));
+      load(R14, RBX, offsetof(JitFrame, globals));
+      break;
+    case RETURN_VALUE:
+      copy(RBX, offsetof(JitFrame, result), R12, top);
+      movImm32(RAX, Jit::RETURNED);
+      exits.push_back(jmp());
+      break;
+    case RETURN_NONE: {
+      const Value none;
+      unsigned long words[2];
+      std::memcpy(words, &none, sizeof(words));
+      movImm(RAX, words[0]);
+      store(RBX, offsetof(JitFrame, result), RAX);
+      movImm(RAX, words[1]);
+      store(RBX, offsetof(JitFrame, result) + 8, RAX);
+      movImm32(RAX, Jit::RETURNED);
+      exits.push_back(jmp());
+      break;
+    }
+  }
+}
+
+// x op y for two ints, or two floats; an int result that overflows
+// bails out so the VM can make it a long
+void JitCompiler::emitArithmetic(int at, Opcode op, int depth) {
+  const int x = slot(depth - 2), y = slot(depth - 1);
+  cmpType(R12, x, Value::INT);
+  const int notInt = jcc(NE);
+  cmpType(R12, y, Value::INT);
+  const int notInts = jcc(NE);
+  load(RAX, R12, x + payloadOffset);
+  switch (op) {
+    case BINARY_ADD: mem(0, true, {0x03}, RAX, R12, y + payloadOffset); break;
+    case BINARY_SUB: mem(0, true, {0x2b}, RAX, R12, y + payloadOffset); break;
+    default: mem(0, true, {0x0f, 0xaf}, RAX, R12, y + payloadOffset); break;
+  }
+  bailout(jcc(O), at, depth);
+  store(R12, x + payloadOffset, RAX);
+  const int done = jmp();
+
+  patch(notInt, here());
+  patch(notInts, here());
+  cmpType(R12, x, Value::FLOAT);
+  bailout(jcc(NE), at, depth);
+  cmpType(R12, y, Value::FLOAT);
+  bailout(jcc(NE), at, depth);
+  mem(0xf2, false, {0x0f, 0x10}, 0, R12, x + payloadOffset);  // movsd xmm0, x
+  switch (op) {
+    case BINARY_ADD: mem(0xf2, false, {0x0f, 0x58}, 0, R12, y + payloadOffset); break;
+    case BINARY_SUB: mem(0xf2, false, {0x0f, 0x5c}, 0, R12, y + payloadOffset); break;
+    default: mem(0xf2, false, {0x0f, 0x59}, 0, R12, y + payloadOffset); break;
+  }
+  mem(0xf2, false, {0x0f, 0x11}, 0, R12, x + payloadOffset);  // movsd x, xmm0
+  patch(done, here());
+}
+
+// x cmp y for two ints, or two floats, leaves a bool
+void JitCompiler::emitCompare(int at, Opcode op, int depth) {
+  const int x = slot(depth - 2), y = slot(depth - 1);
+  cmpType(R12, x, Value::INT);
+  const int notInt = jcc(NE);
+  cmpType(R12, y, Value::INT);
+  const int notInts = jcc(NE);
+  load(RAX, R12, x + payloadOffset);
+  mem(0, true, {0x3b}, RAX, R12, y + payloadOffset);          // cmp rax, y
+  Cond cond = op == COMPARE_LT ? L : op == COMPARE_GT ? G : op == COMPARE_EQ ? E : op == COMPARE_GE ? GE : LE;
+  byte(0x0f); byte(0x90 + cond); byte(0xc0);                  // setcc al
+  const int done = jmp();
+
+  // ucomisd leaves unordered operands (NaN) looking below and equal,
+  // so only above, above-or-equal and equal-and-ordered are used
+  patch(notInt, here());
+  patch(notInts, here());
+  cmpType(R12, x, Value::FLOAT);
+  bailout(jcc(NE), at, depth);
+  cmpType(R12, y, Value::FLOAT);
+  bailout(jcc(NE), at, depth);
+  const bool swap = op == COMPARE_LT || op == COMPARE_LE;
+  mem(0xf2, false, {0x0f, 0x10}, 0, R12, (swap ? y : x) + payloadOffset);  // movsd xmm0
+  mem(0x66, false, {0x0f, 0x2e}, 0, R12, (swap ? x : y) + payloadOffset);  // ucomisd xmm0
+  if (op == COMPARE_EQ) {
+    byte(0x0f); byte(0x94); byte(0xc0);                       // sete al
+    byte(0x0f); byte(0x9b); byte(0xc1);                       // setnp cl
+    byte(0x20); byte(0xc8);                                   // and al, cl
+  } else {
+    cond = op == COMPARE_LT || op == COMPARE_GT ? A : AE;
+    byte(0x0f); byte(0x90 + cond); byte(0xc0);                // setcc al
+  }
+  patch(done, here());
+  byte(0x0f); byte(0xb6); byte(0xc0);                         // movzx eax, al
+  store(R12, x + payloadOffset, RAX);
+  setType(R12, x, Value::BOOL);
+}
+
+NativeCode Jit::compile(const Code& code) {
+  JitCompiler compiler(code);
+  if (!compiler.compile()) {
+    code.jit.rejected = true;
+    ++rejected;
+    return nullptr;
+  }
+  const std::vector<unsigned char>& bytes = compiler.getCode();
+  const unsigned long page = sysconf(_SC_PAGESIZE);
+  const unsigned long size = (bytes.size() + page - 1) / page * page;
+  void* mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (mem == MAP_FAILED) {
+    code.jit.rejected = true;
+    ++rejected;
+    return nullptr;
+  }
+  std::memcpy(mem, bytes.data(), bytes.size());
+  if (mprotect(mem, size, PROT_READ | PROT_EXEC) != 0) {
+    munmap(mem, size);
+    code.jit.rejected = true;
+    ++rejected;
+    return nullptr;
+  }
+  buffers.push_back(std::make_pair(mem, size));
+  ++compiled;
+  codeBytes += bytes.size();
+  code.jit.native = reinterpret_cast<NativeCode>(mem);
+  return code.jit.native;
+}
+
+#else
+
+// no native code on this platform: every body stays interpreted
+NativeCode Jit::compile(const Code& code) {
+  code.jit.rejected = true;
+  ++rejected;
+  return nullptr;
+}
+
+#endif
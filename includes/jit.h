@@ -0,0 +1,98 @@
+#pragma once
+
+//  Baseline JIT for Linux on x86-64, enabled with --jit. Once a
+//  function body has been called often enough, its bytecode is
+//  translated instruction by instruction into machine code from fixed
+//  templates, in a buffer of its own that is mapped executable.
+//
+//  Native code works on the same state as the VM: the operands live in
+//  the code object's part of the VM's operand stack and the variables
+//  in the frame's slots, so every instruction boundary is also a point
+//  where the VM can take over. Int and float arithmetic, comparisons,
+//  branches and variable access are done inline behind guards on the
+//  operand types. A guard that fails (another type, an int overflow, an
+//  unbound variable) bails out: native code returns, and the VM goes on
+//  interpreting the body from the instruction that failed. A body that
+//  keeps bailing out goes back to being interpreted for good. Everything
+//  else, calls included, goes through helper functions, which catch the
+//  errors they raise so that no exception unwinds through native code.
+//
+//  Native calls nest on the C stack. Past a fixed depth, calls are
+//  interpreted, which keeps deep recursion within the VM's frame stack.
+
+#include <exception>
+#include <iosfwd>
+#include <vector>
+#include "bytecode.h"
+
+// The state native code runs on, see VirtualMachine::call.
+struct JitFrame {
+  Value* stack;    // the code object's part of the operand stack
+  Value* locals;   // the frame's slots
+  Value* globals;
+  const Code* code;
+  unsigned long base;  // offset of stack, to find it again if a call grows the stack
+  Value result;
+  // where the VM takes over after a bailout
+  int pc;
+  int sp;
+};
+
+class Jit {
+public:
+  enum Status { CONTINUE, RETURNED, BAILOUT, FAILED };
+
+  static Jit& getInstance();
+  ~Jit();
+
+  // compile function bodies once they have been called calls times
+  void setThreshold(unsigned long calls) { enabled = true; threshold = calls; }
+  void disable() { enabled = false; }
+  bool isEnabled() const { return enabled; }
+
+  // the native code to run code with, nullptr if it is to be interpreted
+  NativeCode enter(const Code& code) {
+    if (!enabled || depth >= maxDepth) return nullptr;
+    if (code.jit.native || code.jit.rejected) return code.jit.native;
+    if (++code.jit.calls < threshold) return nullptr;
+    return compile(code);
+  }
+  // runs native code on frame; a FAILED run is finished with rethrow
+  Status run(NativeCode, JitFrame& frame);
+  void rethrow();
+
+  // for the helpers called from native code
+  void fail(std::exception_ptr err) { error = err; }
+
+  void printStats(std::ostream&) const;
+
+  static const unsigned long defaultThreshold = 100;
+
+  Jit(const Jit&) = delete;
+  Jit& operator=(const Jit&) = delete;
+private:
+  Jit() : enabled(false), threshold(0), depth(0), error(), buffers(),
+    compiled(0), rejected(0), codeBytes(0), nativeRuns(0), bailouts(0), abandoned(0) {}
+
+  NativeCode compile(const Code&);
+
+  // native calls nested on the C stack at most
+  static const unsigned long maxDepth = 2000;
+  // bailouts a body may take before it goes back to the interpreter
+  static const unsigned long maxBailouts = 16;
+
+  bool enabled;
+  unsigned long threshold;
+  unsigned long depth;
+  std::exception_ptr error;
+  // executable mappings, kept until exit: a body that stops being used
+  // may still be running further up the stack
+  std::vector<std::pair<void*, unsigned long> > buffers;
+
+  unsigned long compiled;
+  unsigned long rejected;
+  unsigned long codeBytes;
+  unsigned long nativeRuns;
+  unsigned long bailouts;
+  unsigned long abandoned;
+};
@@ -0,0 +1,225 @@
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include "memo.h"
+#include "ast.h"
+
+Memo& Memo::getInstance() {
+  static thread_local Memo memo;
+  return memo;
+}
+
+unsigned long Memo::KeyHash::operator()(const Key& key) const {
+  unsigned long h = reinterpret_cast<unsigned long>(key.func);
+  for (const Value& arg : key.args) {
+    unsigned long bits = 0;
+    if (arg.getType() == Value::FLOAT) {
+      const double f = arg.getFloat();
+      std::memcpy(&bits, &f, sizeof(bits));
+    } else {
+      bits = arg.getInt();
+    }
+    h = (h ^ (bits + arg.getType())) * 1099511628211UL;
+  }
+  return h;
+}
+
+bool Memo::KeyEqual::operator()(const Key& x, const Key& y) const {
+  if (x.func != y.func || x.args.size() != y.args.size()) return false;
+  for (unsigned long i = 0; i < x.args.size(); ++i) {
+    // exact types: f(1), f(1.0) and f(True) may all return different things
+    if (!x.args[i].isSame(y.args[i])) return false;
+  }
+  return true;
+}
+
+void Memo::sync() {
+  const unsigned long current = TableManager::getInstance().getFuncVersion();
+  if (current == version) return;
+  version = current;
+  verdicts.clear();
+  if (!lru.empty()) {
+    index.clear();
+    lru.clear();
+    ++flushes;
+  }
+}
+
+// A function is pure if its body is and every function it calls,
+// looked up among the globals, is pure too. Calls can be recursive,
+// so purity is settled for everything reachable from func at once:
+// start from what the bodies say and drop callers of impure
+// functions until nothing changes.
+bool Memo::isPure(const FuncNode* func) {
+  std::unordered_map<const FuncNode*, bool>::const_iterator known = verdicts.find(func);
+  if (known != verdicts.end()) return known->second;
+
+  TableManager& tm = TableManager::getInstance();
+  std::vector<const FuncNode*> reached(1, func);
+  std::unordered_map<const FuncNode*, bool> pure;
+  for (unsigned long i = 0; i < reached.size(); ++i) {
+    const FuncNode* f = reached[i];
+    std::unordered_map<const FuncNode*, PurityCheck>::iterator body = bodies.find(f);
+    if (body == bodies.end()) {
+      PurityCheck check;
+      f->getSuite()->checkPurity(check);
+      body = bodies.insert(std::make_pair(f, check)).first;
+    }
+    pure[f] = body->second.isPure();
+    for (const Atom* name : body->second.getCallees()) {
+      const FuncNode* callee = tm.getGlobalFunc(name);
+      if (!callee) {
+        pure[f] = false;
+      } else if (!pure.count(callee) && std::find(reached.begin(), reached.end(), callee) == reached.end()) {
+        reached.push_back(callee);
+      }
+    }
+  }
+  for (bool changed = true; changed; ) {
+    changed = false;
+    for (const FuncNode* f : reached) {
+      if (!pure[f]) continue;
+      for (const Atom* name : bodies[f].getCallees()) {
+        if (!pure[tm.getGlobalFunc(name)]) {
+          pure[f] = false;
+          changed = true;
+          break;
+        }
+      }
+    }
+  }
+  for (const FuncNode* f : reached) {
+    verdicts[f] = pure[f];
+  }
+  return pure[func];
+}
+
+bool Memo::applies(const FuncNode* func, const Value* args, unsigned long n) {
+  if (!isEnabled() || !TableManager::getInstance().functionsAreGlobal()) return false;
+  for (unsigned long i = 0; i < n; ++i) {
+    if (args[i].isObject()) return false;
+  }
+  sync();
+  return isPure(func);
+}
+
+bool Memo::find(const FuncNode* func, const Value* args, unsigned long n, Value& res) {
+  const Key key{func, std::vector<Value>(args, args + n)};
+  std::unordered_map<Key, std::list<Entry>::iterator, KeyHash, KeyEqual>::iterator it = index.find(key);
+  if (it == index.end()) {
+    ++misses;
+    return false;
+  }
+  ++hits;
+  lru.splice(lru.begin(), lru, it->second);
+  res = it->second->result;
+  return true;
+}
+
+void Memo::store(const FuncNode* func, const Value* args, unsigned long n, const Value& res) {
+  // a def run by the call itself would have made the function impure,
+  // but a call that raised never gets here, so the version still holds
+  if (res.isObject()) return;
+  Key key{func, std::vector<Value>(args, args + n)};
+  if (index.count(key)) return;
+  if (lru.size() >= capacity) {
+    index.erase(lru.back().key);
+    lru.pop_back();
+    ++evictions;
+  }
+  lru.push_front(Entry{key, res});
+  index[lru.front().key] = lru.begin();
+}
+
+// roughly what the entries cost: list node, index node and arguments
+unsigned long Memo::bytes() const {
+  unsigned long total = 0;
+  for (const Entry& entry : lru) {
+    total += sizeof(Entry) + 2 * sizeof(void*)
+      + sizeof(Key) + sizeof(std::list<Entry>::iterator) + 2 * sizeof(void*)
+      + 2 * entry.key.args.capacity() * sizeof(Value);
+  }
+  return total;
+}
+
+void Memo::printStats(std::ostream& out) const {
+  const unsigned long calls = hits + misses;
+  out << "memo: " << hits << " hits, " << misses << " misses";
+  if (calls) {
+    out << std::fixed << std::setprecision(1) << " (" << 100.0 * hits / calls << "% hit rate)";
+    out.unsetf(std::ios_base::floatfield);
+  }
+  out << std::endl;
+  out << "memo: " << lru.size() << " entries of " << capacity << ", about " << bytes()
+      << " bytes, " << evictions << " evicted, " << flushes << " flushes" << std::endl;
+}
+
+// Purity of function bodies. A construct not listed here is impure.
+
+void Node::checkPurity(PurityCheck& check) const {
+  check.impure();
+}
+
+void IdentNode::checkPurity(PurityCheck& check) const {
+  // globals and enclosing variables can change between calls
+  if (loc.kind != Location::LOCAL) check.impure();
+}
+
+void PrintNode::checkPurity(PurityCheck& check) const {
+  check.impure();
+}
+
+void IfNode::checkPurity(PurityCheck& check) const {
+  comparison->checkPurity(check);
+  if (ifBranch) ifBranch->checkPurity(check);
+  if (elseBranch) elseBranch->checkPurity(check);
+}
+
+void SuiteNode::checkPurity(PurityCheck& check) const {
+  for (const Node* stmt : stmts) {
+    if (stmt) stmt->checkPurity(check);
+  }
+}
+
+void FuncNode::checkPurity(PurityCheck& check) const {
+  // a nested def binds a function in the frame
+  check.impure();
+}
+
+void ParamNode::checkPurity(PurityCheck& check) const {
+  for (const Node* param : params) {
+    param->checkPurity(check);
+  }
+}
+
+void CallNode::checkPurity(PurityCheck& check) const {
+  check.call(funcName);
+  if (arguments) arguments->checkPurity(check);
+}
+
+void ReturnNode::checkPurity(PurityCheck& check) const {
+  if (testlist) testlist->checkPurity(check);
+}
+
+void UnaryNode::checkPurity(PurityCheck& check) const {
+  node->checkPurity(check);
+}
+
+void BinaryNode::checkPurity(PurityCheck& check) const {
+  if (!left || !right) {
+    check.impure();
+    return;
+  }
+  left->checkPurity(check);
+  right->checkPurity(check);
+}
+
+void AsgBinaryNode::checkPurity(PurityCheck& check) const {
+  // an assignment in a function body always binds a local
+  if (!right) {
+    check.impure();
+    return;
+  }
+  right->checkPurity(check);
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+//  Memoization of pure functions, enabled with --memoize. A function is
+//  pure if its body only reads its own locals, prints nothing, defines
+//  no functions, and only calls functions that are pure themselves.
+//  Such a function returns the same value for the same arguments, so a
+//  call can be answered from a cache keyed by the function and its
+//  argument values.
+//
+//  Which function a name calls depends on the defs that have run, so
+//  verdicts and cached results are only kept while the TableManager's
+//  function version stays the same, and only used while every function
+//  name resolves among the globals. Arguments and results must be
+//  unboxed values: a str result would have to be kept alive by the
+//  cache. The cache holds a bounded number of results and evicts the
+//  least recently used one.
+
+#include <iosfwd>
+#include <list>
+#include <unordered_map>
+#include <vector>
+#include "value.h"
+
+class Atom;
+class FuncNode;
+
+// What a function body does, as far as purity goes; see Node::checkPurity.
+class PurityCheck {
+public:
+  PurityCheck() : pure(true), callees() {}
+  void impure() { pure = false; }
+  void call(const Atom* name) { callees.push_back(name); }
+  bool isPure() const { return pure; }
+  const std::vector<const Atom*>& getCallees() const { return callees; }
+private:
+  bool pure;
+  std::vector<const Atom*> callees;
+};
+
+class Memo {
+public:
+  static Memo& getInstance();
+
+  // entries kept at most, 0 turns memoization off
+  void setCapacity(unsigned long entries) { capacity = entries; }
+  bool isEnabled() const { return capacity > 0; }
+
+  // whether a call of func with these arguments may be memoized now
+  bool applies(const FuncNode* func, const Value* args, unsigned long n);
+  // the cached result of an applicable call, if there is one
+  bool find(const FuncNode* func, const Value* args, unsigned long n, Value& res);
+  void store(const FuncNode* func, const Value* args, unsigned long n, const Value& res);
+
+  void printStats(std::ostream&) const;
+
+  Memo(const Memo&) = delete;
+  Memo& operator=(const Memo&) = delete;
+private:
+  Memo() : capacity(0), version(0), bodies(), verdicts(), lru(), index(),
+    hits(0), misses(0), evictions(0), flushes(0) {}
+
+  struct Key {
+    const FuncNode* func;
+    std::vector<Value> args;
+  };
+  struct KeyHash {
+    unsigned long operator()(const Key&) const;
+  };
+  struct KeyEqual {
+    bool operator()(const Key&, const Key&) const;
+  };
+  struct Entry {
+    Key key;
+    Value result;
+  };
+
+  bool isPure(const FuncNode*);
+  // forgets verdicts and results made under an older function version
+  void sync();
+  unsigned long bytes() const;
+
+  unsigned long capacity;
+  unsigned long version;
+  // what each function body does, which never changes
+  std::unordered_map<const FuncNode*, PurityCheck> bodies;
+  // purity of functions, for the current version
+  std::unordered_map<const FuncNode*, bool> verdicts;
+  // most recently used first
+  std::list<Entry> lru;
+  std::unordered_map<Key, std::list<Entry>::iterator, KeyHash, KeyEqual> index;
+
+  unsigned long hits;
+  unsigned long misses;
+  unsigned long evictions;
+  unsigned long flushes;
+};
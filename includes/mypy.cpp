@@ -0,0 +1,122 @@
+#include <condition_variable>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include "mypy.h"
+#include "poolOfNodes.h"
+
+namespace mypy {
+
+// the thread an Interpreter's scripts run on, and the one task it has
+// been handed, if any
+struct Interpreter::Worker {
+  typedef std::function<int(::Interpreter&)> Task;
+
+  explicit Worker(const Options& options) :
+    calls(), mutex(), posted(), finished(), task(), status(EXIT_SUCCESS), stop(false),
+    thread(&Worker::loop, this, options) {}
+
+  ~Worker() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stop = true;
+    }
+    posted.notify_one();
+    thread.join();
+  }
+
+  // runs step on the thread, with what it writes captured
+  Result call(const Task& step) {
+    std::lock_guard<std::mutex> one(calls);
+    Result result;
+    std::ostringstream out, err;
+    std::unique_lock<std::mutex> lock(mutex);
+    task = [&](::Interpreter& interpreter) {
+      interpreter.setOutput(out);
+      interpreter.setErrors(err);
+      const int status = step(interpreter);
+      interpreter.setOutput(std::cout);
+      interpreter.setErrors(std::cerr);
+      return status;
+    };
+    posted.notify_one();
+    finished.wait(lock, [this]() { return !task; });
+    result.status = status;
+    result.output = out.str();
+    result.errors = err.str();
+    return result;
+  }
+
+  void loop(const Options& options) {
+    ::Interpreter& interpreter = ::Interpreter::getInstance();
+    interpreter.configure(options);
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+      posted.wait(lock, [this]() { return task || stop; });
+      if (!task) break;
+      lock.unlock();
+      const int result = task(interpreter);
+      lock.lock();
+      status = result;
+      task = nullptr;
+      finished.notify_one();
+    }
+    lock.unlock();
+    PoolOfNodes::getInstance().drainThePool();
+  }
+
+  std::mutex calls;  // held for the whole of a call
+  std::mutex mutex;
+  std::condition_variable posted;
+  std::condition_variable finished;
+  Task task;
+  int status;
+  bool stop;
+  std::thread thread;
+};
+
+Interpreter::Interpreter(const Options& options) : worker(new Worker(options)) {}
+
+Interpreter::~Interpreter() {}
+
+Result Interpreter::compile(const std::string& source, Program& program) {
+  program.owner = this;
+  program.stmts.clear();
+  Result result = worker->call([&](::Interpreter& interpreter) {
+    return interpreter.compile(source.data(), source.size(), program.stmts);
+  });
+  // a statement parsed before the error is no program
+  if (result.status != EXIT_SUCCESS) program.stmts.clear();
+  return result;
+}
+
+Result Interpreter::run(const Program& program) {
+  if (program.owner != this) {
+    Result result;
+    result.status = EXIT_FAILURE;
+    result.errors = "the program was compiled by another interpreter\n";
+    return result;
+  }
+  return worker->call([&](::Interpreter& interpreter) {
+    return interpreter.execute(program.stmts);
+  });
+}
+
+Result Interpreter::run(const std::string& source) {
+  return worker->call([&](::Interpreter& interpreter) {
+    std::vector<Node*> stmts;
+    const int status = interpreter.compile(source.data(), source.size(), stmts);
+    return status == EXIT_SUCCESS ? interpreter.execute(stmts) : status;
+  });
+}
+
+Result Interpreter::runFile(const std::string& filename) {
+  return worker->call([&](::Interpreter& interpreter) {
+    return interpreter.run(filename.c_str());
+  });
+}
+
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+//  The interpreter as a library, libmypy.a, for a host that runs many
+//  small scripts and cannot pay for a process each time:
+//
+//    mypy::Interpreter python;
+//    python.run("def f(x):\n    return x * 2\n");
+//    mypy::Result result = python.run("print f(21)\n");  // "42\n"
+//
+//  An Interpreter keeps what its scripts define, functions and globals,
+//  from one call to the next, and a Program, parsed once, can be run on
+//  it any number of times. What a call prints comes back in its Result.
+//
+//  Everything a script changes is thread-local (see interpreter.h), so
+//  each Interpreter runs its scripts on a thread of its own, and calls
+//  from the host wait for it. Interpreters are independent: several can
+//  run at once, and one can be called from any thread, a call at a time.
+//  The nodes of every script parsed are kept until the Interpreter goes.
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "interpreter.h"
+
+class Node;
+
+namespace mypy {
+
+struct Result {
+  Result() : status(0), output(), errors() {}
+  int status;          // EXIT_SUCCESS, or EXIT_FAILURE after an error
+  std::string output;  // what print wrote, then a run-time error if any
+  std::string errors;  // syntax errors, and files that could not be read
+};
+
+class Interpreter;
+
+// a script parsed by one Interpreter, to be run on that one only
+class Program {
+public:
+  Program() : owner(nullptr), stmts() {}
+  // a copy runs the same nodes
+  Program(const Program&) = default;
+  Program& operator=(const Program&) = default;
+  bool isEmpty() const { return stmts.empty(); }
+private:
+  friend class Interpreter;
+  const Interpreter* owner;
+  std::vector<Node*> stmts;
+};
+
+class Interpreter {
+public:
+  typedef ::Interpreter::Options Options;
+
+  explicit Interpreter(const Options& options = Options());
+  ~Interpreter();
+
+  // parses source into program, replacing what it held
+  Result compile(const std::string& source, Program& program);
+  Result run(const Program& program);
+  Result run(const std::string& source);
+  // the script in filename, from its .mpyc if that is current, as ./run does
+  Result runFile(const std::string& filename);
+
+  Interpreter(const Interpreter&) = delete;
+  Interpreter& operator=(const Interpreter&) = delete;
+private:
+  struct Worker;
+  std::unique_ptr<Worker> worker;
+};
+
+}
@@ -1,13 +1,46 @@
 #pragma once
 #include <iostream>
+#include "value.h"
 
-class Literal;
+class Compiler;
+class Folder;
+class PurityCheck;
+class ProgramWriter;
+class Resolver;
+
+// How a statement finished: it either ran to the end, or it returned
+// and carries the value the enclosing call hands back to its caller.
+struct Completion {
+  enum Kind { NORMAL, RETURN };
+  Kind kind;
+  Value value;
+  static Completion normal() { return Completion{NORMAL, Value()}; }
+  static Completion returning(const Value& val) { return Completion{RETURN, val}; }
+  bool isAbrupt() const { return kind != NORMAL; }
+};
 
 class Node {
 public:
   Node() {}
   virtual ~Node() {}
-  virtual const Literal* eval() const = 0;
+  virtual Value eval() const = 0;
+  // run as a statement; only statements that transfer control override it
+  virtual Completion execute() const {
+    eval();
+    return Completion::normal();
+  }
+  // lower into bytecode, see compiler.cpp
+  virtual void compile(Compiler&) const;
+  // bind variable references to frame slots, see resolver.cpp
+  virtual void resolve(Resolver&) {}
+  // the node to use in place of this one, see folder.cpp
+  virtual Node* fold(Folder&) { return this; }
+  // one-line s-expression, for --dump-ast
+  virtual void dump(std::ostream&) const;
+  // serialize for the program cache, see programCache.cpp
+  virtual void save(ProgramWriter&) const;
+  // what the node does that matters to memoization, see memo.cpp
+  virtual void checkPurity(PurityCheck&) const;
   virtual void print() const {
     std::cout << "NODE" << std::endl;
   }
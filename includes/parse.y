@@ -1,27 +1,49 @@
 // Generated by transforming |cwd:///work-in-progress/2.7.2-bisonified.y| on 2016-11-23 at 15:46:56 +0000
+%code requires {
+#include "includes/parser.h"
+#include "includes/source.h"
+}
+
 %{
 #include "includes/ast.h"
+#include "includes/bigint.h"
+#include "includes/constants.h"
+#include "includes/folder.h"
+#include "includes/programCache.h"
+#include "includes/gc.h"
+#include "includes/interpreter.h"
+#include "includes/profiler.h"
+%}
 
-int yylex (void);
-extern char *yytext;
-void yyerror (const char *);
-
-PoolOfNodes& pool = PoolOfNodes::getInstance();
+%code {
+int yylex (YYSTYPE*, YYLTYPE*, yyscan_t);
+char* yyget_text(yyscan_t);
+void yyerror (YYLTYPE*, yyscan_t, ParseContext&, const char *);
 
 bool isOpEqual(const char*, const char*);
-%}
+void appendString(std::string&, const TokenView&);
+}
+
+// reentrant: the scanner is passed along, and what the actions build
+// goes through the context
+%define api.pure full
+%param {yyscan_t scanner}
+%parse-param {ParseContext& context}
 
 %union {
 	Node* node;
-	int intNumber;
-	float fltNumber;
+	long intNumber;
+	double fltNumber;
 	char op; // operator
 	const char* cmp; // compare operator
-	char* id;
+	TokenView view; // STRING and LONGINT, in the source
+	const Atom* atom;
+	std::string* text;
 }
 
 %type<op> pick_unop pick_multop pick_PLUS_MINUS augassign
 %type<cmp> comp_op
+%type<text> plus_STRING
 
 %type<node> atom power factor term arith_expr
 %type<node> print_stmt opt_test test or_test and_test not_test opt_IF_ELSE
@@ -34,7 +56,9 @@ bool isOpEqual(const char*, const char*);
 
 %token<intNumber> INT
 %token<fltNumber> FLOAT
-%token<id> NAME
+%token<atom> NAME
+%token<view> STRING
+%token<view> LONGINT
 
 // 83 tokens, in alphabetical order:
 %token AMPEREQUAL AMPERSAND AND AS ASSERT AT BACKQUOTE BAR BREAK CIRCUMFLEX
@@ -45,7 +69,7 @@ bool isOpEqual(const char*, const char*);
 %token LESSEQUAL LPAR LSQB MINEQUAL MINUS NEWLINE NOT NOTEQUAL NUMBER
 %token OR PASS PERCENT PERCENTEQUAL PLUS PLUSEQUAL PRINT RAISE RBRACE RETURN
 %token RIGHTSHIFT RIGHTSHIFTEQUAL RPAR RSQB SEMI SLASH SLASHEQUAL STAR STAREQUAL
-%token STRING TILDE TRY VBAREQUAL WHILE WITH YIELD
+%token TILDE TRY VBAREQUAL WHILE WITH YIELD
 
 %start start
 
@@ -61,11 +85,14 @@ file_input // Used in: start
 	;
 pick_NEWLINE_stmt // Used in: star_NEWLINE_stmt
 	: NEWLINE {
-		$$ = new PrintNode(nullptr);
-		pool.add($$);
+		$$ = context.pool.make<PrintNode>(nullptr);
 	}
 	| stmt {
-		if ($1) $1->eval();
+		if ($1) {
+			$1 = Folder::getInstance().fold($1);
+			ProgramCache::getInstance().record($1);
+			context.stmts.push_back($1);
+		}
 	}
 	;
 star_NEWLINE_stmt // Used in: file_input, star_NEWLINE_stmt
@@ -93,8 +120,7 @@ funcdef // Used in: decorated, compound_stmt
 		if ($5 == nullptr) {
 			$$ = nullptr;
 		} else {
-			$$ = new FuncNode($2, $3, $5);
-			pool.add($$);
+			$$ = context.pool.make<FuncNode>($2, $3, $5);
 		}
 	}
 	;
@@ -114,9 +140,8 @@ varargslist // Used in: parameters, old_lambdef, lambdef
 			$$ = $1;
 		} else {
 			// only one positional parameter
-			$$ = new ParamNode();
+			$$ = context.pool.make<ParamNode>();
 			reinterpret_cast<ParamNode*>($$)->append($2);
-			pool.add($$);
 		}
 	}
 	;
@@ -127,15 +152,13 @@ opt_EQUAL_test // Used in: varargslist, star_fpdef_COMMA
 star_fpdef_COMMA // Used in: varargslist, star_fpdef_COMMA
 	: star_fpdef_COMMA fpdef opt_EQUAL_test COMMA {
 		if ($3) {
-			$2 = new AsgBinaryNode($2, $3);
-			pool.add($2);
+			$2 = context.pool.make<AsgBinaryNode>($2, $3);
 		}
 		if ($1) {
 			reinterpret_cast<ParamNode*>($1)->append($2);
 			$$ = $1;
 		} else {
-			$$ = new ParamNode();
-			pool.add($$);
+			$$ = context.pool.make<ParamNode>();
 			reinterpret_cast<ParamNode*>($$)->append($2);
 		}
 	}
@@ -155,9 +178,7 @@ opt_COMMA // Used in: varargslist, opt_test, opt_test_2, testlist_safe, listmake
 	;
 fpdef // Used in: varargslist, star_fpdef_COMMA, fplist, star_fpdef_notest
 	: NAME {
-		$$ = new IdentNode($1);
-		delete[] $1;
-		pool.add($$);
+		$$ = context.pool.make<IdentNode>($1);
 	}
 	| LPAR fplist RPAR { $$ = $2; }
 	;
@@ -167,8 +188,7 @@ fplist // Used in: fpdef
 			reinterpret_cast<ParamNode*>($2)->append($1);
 			$$ = $2;
 		} else {
-			$$ = new ParamNode();
-			pool.add($$);
+			$$ = context.pool.make<ParamNode>();
 			reinterpret_cast<ParamNode*>($$)->append($1);
 		}
 	}
@@ -177,8 +197,7 @@ fplist // Used in: fpdef
 			reinterpret_cast<ParamNode*>($2)->append($1);
 			$$ = $2;
 		} else {
-			$$ = new ParamNode();
-			pool.add($$);
+			$$ = context.pool.make<ParamNode>();
 			reinterpret_cast<ParamNode*>($$)->append($1);
 		}
 	}
@@ -189,16 +208,25 @@ star_fpdef_notest // Used in: fplist, star_fpdef_notest
 			reinterpret_cast<ParamNode*>($1)->append($3);
 			$$ = $1;
 		} else {
-			$$ = new ParamNode();
-			pool.add($$);
+			$$ = context.pool.make<ParamNode>();
 			reinterpret_cast<ParamNode*>($$)->append($3);
 		}
 	}
 	| %empty { $$ = nullptr; }
 	;
 stmt // Used in: pick_NEWLINE_stmt, plus_stmt
-	: simple_stmt
-	| compound_stmt
+	: simple_stmt {
+		if ($1 && Profiler::getInstance().isEnabled()) {
+			Profiler::getInstance().setLine($1, @1.first_line);
+		}
+		$$ = $1;
+	}
+	| compound_stmt {
+		if ($1 && Profiler::getInstance().isEnabled()) {
+			Profiler::getInstance().setLine($1, @1.first_line);
+		}
+		$$ = $1;
+	}
 	;
 simple_stmt // Used in: stmt, suite
 	: small_stmt star_SEMI_small_stmt SEMI NEWLINE
@@ -227,31 +255,28 @@ expr_stmt // Used in: small_stmt
 			Node* res;
 			switch($2) {
 				case '1':
-					res = new AddBinaryNode($1, $3); break;
+					res = context.pool.make<AddBinaryNode>($1, $3); break;
 				case '2':
-					res = new SubBinaryNode($1, $3); break;
+					res = context.pool.make<SubBinaryNode>($1, $3); break;
 				case '3':
-					res = new MulBinaryNode($1, $3); break;
+					res = context.pool.make<MulBinaryNode>($1, $3); break;
 				case '4':
-					res = new DivBinaryNode($1, $3); break;
+					res = context.pool.make<DivBinaryNode>($1, $3); break;
 				case '5':
-					res = new ModBinaryNode($1, $3); break;
+					res = context.pool.make<ModBinaryNode>($1, $3); break;
 				case '6':
-					res = new ExpBinaryNode($1, $3); break;
+					res = context.pool.make<ExpBinaryNode>($1, $3); break;
 				case '7':
-					res = new IntDivBinaryNode($1, $3); break;
+					res = context.pool.make<IntDivBinaryNode>($1, $3); break;
 			}
-			$$ = new AsgBinaryNode($1, res);
-			pool.add($$);
-			pool.add(res);
+			$$ = context.pool.make<AsgBinaryNode>($1, res);
 		}
 	}
 	| testlist star_EQUAL {
 		if (!$2) {
 			$$ = $1;
 		} else {
-			$$ = new AsgBinaryNode($1, $2);
-			pool.add($$);
+			$$ = context.pool.make<AsgBinaryNode>($1, $2);
 		}
 	}
 	;
@@ -264,8 +289,7 @@ star_EQUAL // Used in: expr_stmt, star_EQUAL
 		if (!$3) {
 			$$ = $2;
 		} else {
-			$$ = new AsgBinaryNode($2, $3);
-			pool.add($$);
+			$$ = context.pool.make<AsgBinaryNode>($2, $3);
 		}
 	}
 	| %empty { $$ = nullptr; }
@@ -286,8 +310,7 @@ augassign // Used in: expr_stmt
 	;
 print_stmt // Used in: small_stmt
 	: PRINT opt_test {
-		$$ = new PrintNode($2);
-		pool.add($$);
+		$$ = context.pool.make<PrintNode>($2);
 	}
 	| PRINT RIGHTSHIFT test opt_test_2 { // print >> sys.stderr, '--'
 		$$ = nullptr;
@@ -330,12 +353,10 @@ continue_stmt // Used in: flow_stmt
 	;
 return_stmt // Used in: flow_stmt
 	: RETURN testlist {
-		$$ = new ReturnNode($2);
-		pool.add($$);
+		$$ = context.pool.make<ReturnNode>($2);
 	}
 	| RETURN {
-		$$ = new ReturnNode();
-		pool.add($$);
+		$$ = context.pool.make<ReturnNode>();
 	}
 	;
 yield_stmt // Used in: flow_stmt
@@ -423,12 +444,10 @@ compound_stmt // Used in: stmt
 	;
 if_stmt // Used in: compound_stmt
 	: IF test COLON suite star_ELIF ELSE COLON suite {
-		$$ = new IfNode($2, $4, $8);
-		pool.add($$);
+		$$ = context.pool.make<IfNode>($2, $4, $8);
 	}
 	| IF test COLON suite star_ELIF {
-		$$ = new IfNode($2, $4, nullptr);
-		pool.add($$);
+		$$ = context.pool.make<IfNode>($2, $4, nullptr);
 	}
 	;
 star_ELIF // Used in: if_stmt, star_ELIF
@@ -484,11 +503,9 @@ opt_AS_COMMA // Used in: except_clause
 	;
 suite // Used in: funcdef, if_stmt, star_ELIF, while_stmt, for_stmt, try_stmt, plus_except, opt_ELSE, opt_FINALLY, with_stmt, classdef
 	: simple_stmt {
-		SuiteNode* suite = new SuiteNode();
+		SuiteNode* suite = context.pool.make<SuiteNode>();
 		suite->append($1);
 		$$ = suite;
-		delete suite;
-		pool.add($$);
 	}
 	| NEWLINE INDENT plus_stmt DEDENT { $$ = $3; }
 	;
@@ -498,9 +515,8 @@ plus_stmt // Used in: suite, plus_stmt
 		$$ = $1;
 	}
 	| stmt {
-		$$ = new SuiteNode();
+		$$ = context.pool.make<SuiteNode>();
 		static_cast<SuiteNode*>($$)->append($1);
-		pool.add($$);
 	}
 	;
 testlist_safe // Used in: list_for
@@ -543,20 +559,15 @@ comparison // Used in: not_test, comparison
 	: expr { $$ = $1; }
 	| comparison comp_op expr {
 		if (isOpEqual($2, "<")) {
-			$$ = new LessBinaryNode($1, $3);
-			pool.add($$);
+			$$ = context.pool.make<LessBinaryNode>($1, $3);
 		} else if (isOpEqual($2, ">")) {
-			$$ = new GreaterBinaryNode($1, $3);
-			pool.add($$);
+			$$ = context.pool.make<GreaterBinaryNode>($1, $3);
 		} else if (isOpEqual($2, "==")) {
-			$$ = new EqualBinaryNode($1, $3);
-			pool.add($$);
+			$$ = context.pool.make<EqualBinaryNode>($1, $3);
 		} else if (isOpEqual($2, ">=")) {
-			$$ = new GrtEqBinaryNode($1, $3);
-			pool.add($$);
+			$$ = context.pool.make<GrtEqBinaryNode>($1, $3);
 		} else if (isOpEqual($2, "<=")) {
-			$$ = new LessEqBinaryNode($1, $3);
-			pool.add($$);
+			$$ = context.pool.make<LessEqBinaryNode>($1, $3);
 		}
 	}
 	;
@@ -597,12 +608,10 @@ arith_expr // Used in: shift_expr, arith_expr
 	: term
 	| arith_expr pick_PLUS_MINUS term {
 		if ($2 == '+') {
-			$$ = new AddBinaryNode($1, $3);
-			pool.add($$);
+			$$ = context.pool.make<AddBinaryNode>($1, $3);
 		}
 		if ($2 == '-') {
-			$$ = new SubBinaryNode($1, $3);
-			pool.add($$);
+			$$ = context.pool.make<SubBinaryNode>($1, $3);
 		}
 	}
 	;
@@ -615,17 +624,17 @@ term // Used in: arith_expr, term
 	| term pick_multop factor {
 		switch($2) {
 			case '*':
-				$$ = new MulBinaryNode($1, $3);
-				pool.add($$); break;
+				$$ = context.pool.make<MulBinaryNode>($1, $3);
+				break;
 			case '/':
-				$$ = new DivBinaryNode($1, $3);
-				pool.add($$); break;
+				$$ = context.pool.make<DivBinaryNode>($1, $3);
+				break;
 			case '%':
-				$$ = new ModBinaryNode($1, $3);
-				pool.add($$); break;
+				$$ = context.pool.make<ModBinaryNode>($1, $3);
+				break;
 			case '@':
-				$$ = new IntDivBinaryNode($1, $3);
-				pool.add($$); break;
+				$$ = context.pool.make<IntDivBinaryNode>($1, $3);
+				break;
 			default:
 				$$ = nullptr; break;
 		};
@@ -638,7 +647,7 @@ pick_multop // Used in: term
 	| DOUBLESLASH { $$ = '@'; }
 	;
 factor // Used in: term, factor, power
-	: pick_unop factor { $$ = new UnaryNode($1, $2); }
+	: pick_unop factor { $$ = context.pool.make<UnaryNode>($1, $2); }
 	| power
 	;
 pick_unop // Used in: factor
@@ -648,8 +657,7 @@ pick_unop // Used in: factor
 	;
 power // Used in: factor
 	: atom star_trailer DOUBLESTAR factor {	// pow(atom, factor)
-		$$ = new ExpBinaryNode($1, $4);
-		pool.add($$);
+		$$ = context.pool.make<ExpBinaryNode>($1, $4);
 	}
 	| atom star_trailer {	// star_trailer: zero or more (), [], .xxx
 		// if ($1 && ($<intNumber>2 == 1)) {
@@ -657,9 +665,7 @@ power // Used in: factor
 			$$ = $1;
 		} else {
 			// reinterpret_cast cheaper than dynamic_cast
-			std::string name = reinterpret_cast<IdentNode*>($1)->getIdent();
-			$$ = new CallNode(name, $2);
-			pool.add($$);
+			$$ = context.pool.make<CallNode>(static_cast<IdentNode*>($1)->getAtom(), $2);
 		}
 	}
 	;
@@ -680,20 +686,25 @@ atom // Used in: power
 	| LBRACE opt_dictorsetmaker RBRACE { $$ = nullptr; }
 	| BACKQUOTE testlist1 BACKQUOTE { $$ = nullptr; }
 	| NAME {
-		$$ = new IdentNode($1);
-		delete[] $1;
-		pool.add($$);
+		$$ = context.pool.make<IdentNode>($1);
 	}
 	| NUMBER { $$ = nullptr; }
 	| INT {
-		$$ = new IntLiteral($1);
-		pool.add($$);
+		$$ = context.constants.integer($1);
+	}
+	| LONGINT {
+		$$ = context.constants.integer(BigInt::parse($1.text, $1.length));
 	}
 	| FLOAT {
-		$$ = new FloatLiteral($1);
-		pool.add($$);
+		$$ = context.constants.number($1);
+	}
+	| plus_STRING {
+		$$ = nullptr;
+		if ($1) {
+			$$ = context.constants.string($1->data(), $1->size());
+			delete $1;
+		}
 	}
-	| plus_STRING { $$ = nullptr; }
 	;
 pick_yield_expr_testlist_comp // Used in: opt_yield_test
 	: yield_expr
@@ -712,8 +723,23 @@ opt_dictorsetmaker // Used in: atom
 	| %empty
 	;
 plus_STRING // Used in: atom, plus_STRING
-	: plus_STRING STRING
-	| STRING
+	: plus_STRING STRING {
+		// adjacent literals are joined; long strings carry no text
+		$$ = $1;
+		if ($$ && $2.text) {
+			appendString(*$$, $2);
+		} else {
+			delete $$;
+			$$ = nullptr;
+		}
+	}
+	| STRING {
+		$$ = nullptr;
+		if ($1.text) {
+			$$ = new std::string();
+			appendString(*$$, $1);
+		}
+	}
 	;
 listmaker // Used in: opt_listmaker
 	: test list_for
@@ -732,12 +758,11 @@ trailer // Used in: star_trailer
 		if ($2) {
 			$$ = $2;
 		} else {
-			$$ = new ParamNode();
-			pool.add($$);
+			$$ = context.pool.make<ParamNode>();
 		}
 	}
 	| LSQB subscriptlist RSQB { $$ = nullptr; }
-	| DOT NAME { delete[] $2; }
+	| DOT NAME { $$ = nullptr; }
 	;
 subscriptlist // Used in: trailer
 	: subscript star_COMMA_subscript COMMA
@@ -807,14 +832,12 @@ arglist // Used in: opt_arglist
 			if ($2) {
 				// another argument
 				reinterpret_cast<ParamNode*>($1)->append($2);
-			} else {
-				$$ = $1;
 			}
+			$$ = $1;
 		} else {
 			// no ParamNode
-			$$ = new ParamNode();
-			reinterpret_cast<ParamNode*>($$)->append($1);
-			pool.add($$);
+			$$ = context.pool.make<ParamNode>();
+			reinterpret_cast<ParamNode*>($$)->append($2);
 		}
 	}
 	;
@@ -824,9 +847,8 @@ star_argument_COMMA // Used in: arglist, star_argument_COMMA
 			reinterpret_cast<ParamNode*>($1)->append($2);
 			$$ = $1;
 		} else {
-			$$ = new ParamNode();
+			$$ = context.pool.make<ParamNode>();
 			reinterpret_cast<ParamNode*>($$)->append($2);
-			pool.add($$);
 		}
 	}
 	| %empty { $$ = nullptr; }
@@ -853,8 +875,7 @@ pick_argument // Used in: arglist
 argument // Used in: star_argument_COMMA, star_COMMA_argument, pick_argument
 	: test opt_comp_for { $$ = $1; }
 	| test EQUAL test {
-		$$ = new AsgBinaryNode($1, $3);
-		pool.add($$);
+		$$ = context.pool.make<AsgBinaryNode>($1, $3);
 	}
 	;
 opt_comp_for // Used in: argument
@@ -900,14 +921,65 @@ star_DOT // Used in: pick_dotted_name, star_DOT
 
 %%
 
-#include <stdio.h>
-void yyerror (const char *s)
+#include <iostream>
+void yyerror (YYLTYPE *yylloc, yyscan_t scanner, ParseContext&, const char *s)
 {
-    if(yylloc.first_line > 0)	{
-        fprintf (stderr, "%d.%d-%d.%d:", yylloc.first_line, yylloc.first_column,
-	                                     yylloc.last_line,  yylloc.last_column);
+    std::ostream& errors = Interpreter::getInstance().getErrors();
+    if(yylloc->first_line > 0)	{
+        errors << yylloc->first_line << "." << yylloc->first_column << "-"
+               << yylloc->last_line << "." << yylloc->last_column << ":";
     }
-    fprintf(stderr, " %s with [%s]\n", s, yytext);
+    errors << " " << s << " with [" << yyget_text(scanner) << "]" << std::endl;
+}
+
+// decodes a short string token, prefix and quotes included
+void appendString(std::string& res, const TokenView& view)
+{
+	bool raw = false;
+	const char* token = view.text;
+	const char* end = view.text + view.length - 1;
+	while (*token != '\'' && *token != '"') {
+		if (*token == 'r' || *token == 'R') raw = true;
+		++token;
+	}
+	for (const char* p = token + 1; p < end; ++p) {
+		if (*p != '\\' || raw) {
+			res += *p;
+			if (raw && *p == '\\' && p + 1 < end) res += *++p;
+			continue;
+		}
+		char c = *++p;
+		switch (c) {
+			case 'n': res += '\n'; break;
+			case 't': res += '\t'; break;
+			case 'r': res += '\r'; break;
+			case 'a': res += '\a'; break;
+			case 'b': res += '\b'; break;
+			case 'f': res += '\f'; break;
+			case 'v': res += '\v'; break;
+			case '\\': case '\'': case '"': res += c; break;
+			case '\n': break;
+			case 'x':
+				if (p + 2 < end && isxdigit(p[1]) && isxdigit(p[2])) {
+					res += static_cast<char>(strtol(std::string(p + 1, 2).c_str(), nullptr, 16));
+					p += 2;
+					break;
+				}
+				throw std::string("ValueError: invalid \\x escape");
+			default:
+				if (c >= '0' && c <= '7') {
+					int val = 0;
+					for (int k = 0; k < 3 && p < end && *p >= '0' && *p <= '7'; ++k) {
+						val = val * 8 + (*p++ - '0');
+					}
+					--p;
+					res += static_cast<char>(val);
+				} else {
+					res += '\\';
+					res += c;
+				}
+		}
+	}
 }
 
 bool isOpEqual(const char* op1, const char* op2)
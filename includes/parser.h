@@ -0,0 +1,37 @@
+#pragma once
+
+//  The entry points of the scanner (scan.l) and the parser (parse.y).
+//  Both are reentrant: the scanner's state lives in the yyscan_t that
+//  init_scanner makes, the parser's on its own stack, and what the
+//  grammar builds goes through a ParseContext. Any number of parses can
+//  run at once, one per thread, each with that thread's node pool and
+//  constants.
+
+#include <vector>
+
+class Node;
+class PoolOfNodes;
+class ConstantPool;
+class Source;
+
+#ifndef YY_TYPEDEF_YY_SCANNER_T
+#define YY_TYPEDEF_YY_SCANNER_T
+typedef void* yyscan_t;
+#endif
+
+// thrown by the scanner once it has reported a lexical error, to end
+// the parse
+struct ScanError {};
+
+struct ParseContext {
+  PoolOfNodes& pool;
+  ConstantPool& constants;
+  // the top-level statements, in order
+  std::vector<Node*>& stmts;
+};
+
+// a scanner over the text of source, which must stay open until
+// end_scanner: tokens point into it
+yyscan_t init_scanner(Source& source);
+void end_scanner(yyscan_t scanner);
+int yyparse(yyscan_t scanner, ParseContext& context);
@@ -1,17 +1,6 @@
-#include "node.h"
-#include "literal.h"
-
+#include "poolOfNodes.h"
 
 PoolOfNodes& PoolOfNodes::getInstance() {
-  static PoolOfNodes pool;
+  static thread_local PoolOfNodes pool;
   return pool;
 }
-
-void PoolOfNodes::drainThePool() {
-  for ( const Node* node : nodePool ) {
-    if (node != nullptr) {
-      delete node;
-    }
-  }
-}
-
@@ -1,12 +1,19 @@
-#include <vector>
-class Node;
+#pragma once
+
+//  Parse region: every AST node lives in one arena that is released
+//  in a single step once the program has finished running.
+
+#include <utility>
+#include "arena.h"
 
 class PoolOfNodes {
 public:
   static PoolOfNodes& getInstance();
-  void add(const Node* node) { nodePool.push_back(node); }
-  void drainThePool();
+  template <class T, class... Args>
+  T* make(Args&&... args) { return arena.make<T>(std::forward<Args>(args)...); }
+  void drainThePool() { arena.reset(); }
+  const Arena& getArena() const { return arena; }
 private:
-  std::vector<const Node*> nodePool;
-  PoolOfNodes() : nodePool() {}
+  Arena arena;
+  PoolOfNodes() : arena("parse") {}
 };
@@ -0,0 +1,178 @@
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sys/time.h>
+#include "profiler.h"
+#include "ast.h"
+#include "gc.h"
+
+volatile sig_atomic_t Profiler::ticks = 0;
+
+Profiler& Profiler::getInstance() {
+  static thread_local Profiler profiler;
+  return profiler;
+}
+
+void Profiler::tick(int) {
+  ticks = ticks + 1;
+}
+
+void Profiler::start(unsigned long usec) {
+  enabled = true;
+  interval = usec;
+  started = Clock::now();
+  // the top level is a call of its own
+  stats[nullptr] = Stats{1, 0, 0, 0, 0, 1};
+  frames.push_back(Frame{nullptr, started, Heap::getInstance().getBytesAllocated(), 0, 0, 0});
+  if (interval) {
+    struct sigaction action;
+    std::memset(&action, 0, sizeof(action));
+    action.sa_handler = tick;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;
+    sigaction(SIGPROF, &action, nullptr);
+    struct itimerval timer;
+    timer.it_interval.tv_sec = interval / 1000000;
+    timer.it_interval.tv_usec = interval % 1000000;
+    timer.it_value = timer.it_interval;
+    setitimer(ITIMER_PROF, &timer, nullptr);
+  }
+}
+
+void Profiler::stop() {
+  if (!enabled) return;
+  if (interval) {
+    struct itimerval off;
+    std::memset(&off, 0, sizeof(off));
+    setitimer(ITIMER_PROF, &off, nullptr);
+  }
+  // an error may have left calls on the stack
+  while (!frames.empty()) {
+    leave();
+  }
+  elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - started).count();
+  enabled = false;
+}
+
+void Profiler::setSource(const std::string& text) {
+  source.clear();
+  std::string::size_type from = 0;
+  while (from < text.size()) {
+    std::string::size_type end = text.find('\n', from);
+    if (end == std::string::npos) end = text.size();
+    source.push_back(text.substr(from, end - from));
+    from = end + 1;
+  }
+}
+
+void Profiler::enter(const FuncNode* func) {
+  Stats& s = stats[func];
+  ++s.calls;
+  ++s.active;
+  frames.push_back(Frame{func, Clock::now(), Heap::getInstance().getBytesAllocated(), 0, 0, 0});
+}
+
+void Profiler::leave() {
+  const Frame frame = frames.back();
+  frames.pop_back();
+  const unsigned long ns =
+    std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - frame.start).count();
+  const unsigned long bytes = Heap::getInstance().getBytesAllocated() - frame.bytes;
+  Stats& s = stats[frame.func];
+  s.exclusiveNs += ns - frame.childNs;
+  s.exclusiveBytes += bytes - frame.childBytes;
+  if (--s.active == 0) {
+    s.inclusiveNs += ns;
+    s.inclusiveBytes += bytes;
+  }
+  if (!frames.empty()) {
+    frames.back().childNs += ns;
+    frames.back().childBytes += bytes;
+  }
+}
+
+void Profiler::sample() {
+  const unsigned long n = ticks;
+  ticks = 0;
+  Stack stack;
+  stack.reserve(frames.size());
+  for (const Frame& frame : frames) {
+    stack.push_back(std::make_pair(frame.func, frame.line));
+  }
+  samples[stack] += n;
+  lineSamples[frames.back().line] += n;
+  totalSamples += n;
+}
+
+namespace {
+
+std::string nameOf(const FuncNode* func) {
+  return func ? func->getName()->str() : "<module>";
+}
+
+}
+
+void Profiler::report(std::ostream& out) const {
+  std::vector<std::pair<const FuncNode*, Stats> > rows(stats.begin(), stats.end());
+  std::sort(rows.begin(), rows.end(),
+            [](const std::pair<const FuncNode*, Stats>& x, const std::pair<const FuncNode*, Stats>& y) {
+              return x.second.exclusiveNs > y.second.exclusiveNs;
+            });
+  unsigned long calls = 0;
+  for (const std::pair<const FuncNode*, Stats>& row : rows) {
+    if (row.first) calls += row.second.calls;
+  }
+  out << "profile: " << calls << " calls of " << rows.size() - 1 << " functions in "
+      << std::fixed << std::setprecision(3) << elapsed / 1e6 << " ms" << std::endl;
+  out << std::left << std::setw(20) << "function" << std::right
+      << std::setw(12) << "calls"
+      << std::setw(12) << "incl ms"
+      << std::setw(12) << "excl ms"
+      << std::setw(12) << "incl bytes"
+      << std::setw(12) << "excl bytes" << std::endl;
+  for (const std::pair<const FuncNode*, Stats>& row : rows) {
+    const Stats& s = row.second;
+    out << std::left << std::setw(20) << nameOf(row.first) << std::right
+        << std::setw(12) << s.calls
+        << std::setw(12) << s.inclusiveNs / 1e6
+        << std::setw(12) << s.exclusiveNs / 1e6
+        << std::setw(12) << s.inclusiveBytes
+        << std::setw(12) << s.exclusiveBytes << std::endl;
+  }
+  if (!interval) {
+    out.unsetf(std::ios_base::floatfield);
+    return;
+  }
+
+  std::vector<std::pair<int, unsigned long> > hot(lineSamples.begin(), lineSamples.end());
+  std::stable_sort(hot.begin(), hot.end(),
+                   [](const std::pair<int, unsigned long>& x, const std::pair<int, unsigned long>& y) {
+                     return x.second > y.second;
+                   });
+  out << "profile: " << totalSamples << " samples, one every " << interval << " us" << std::endl;
+  out << std::setw(6) << "line" << std::setw(10) << "samples" << std::setw(8) << "%"
+      << "  source" << std::endl;
+  for (const std::pair<int, unsigned long>& row : hot) {
+    out << std::setw(6) << row.first << std::setw(10) << row.second
+        << std::setw(7) << std::setprecision(1) << 100.0 * row.second / totalSamples << "%  ";
+    if (row.first > 0 && static_cast<unsigned long>(row.first) <= source.size()) {
+      const std::string& text = source[row.first - 1];
+      const std::string::size_type indent = text.find_first_not_of(" \t");
+      if (indent != std::string::npos) out << text.substr(indent);
+    }
+    out << std::endl;
+  }
+  out.unsetf(std::ios_base::floatfield);
+}
+
+void Profiler::writeStacks(std::ostream& out) const {
+  for (const std::pair<const Stack, unsigned long>& entry : samples) {
+    const char* sep = "";
+    for (const std::pair<const FuncNode*, int>& frame : entry.first) {
+      out << sep << nameOf(frame.first) << ':' << frame.second;
+      sep = ";";
+    }
+    out << ' ' << entry.second << std::endl;
+  }
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+//  Profiler, enabled with --profile. Both engines report each call and
+//  return, and the statement they are about to run, so the profiler
+//  keeps a stack of the active calls. From it, it accounts for the
+//  calls of every function, the time spent in them (inclusive and
+//  exclusive of their callees) and the bytes they allocated on the
+//  collected heap.
+//
+//  With --profile=lines it also samples: a SIGPROF timer only sets a
+//  flag, and the next statement or call the engines report takes the
+//  sample, with the line being run in each active call. Samples are
+//  reported per source line, and can be written as collapsed stacks
+//  for flamegraph.pl. The parser records the lines statements start on
+//  only while profiling, and the VM only keeps a line table then.
+//
+//  The hooks cost a test of a flag when profiling is off, and nothing
+//  in builds with MYPY_NO_PROFILER defined.
+
+#include <chrono>
+#include <csignal>
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class Node;
+class FuncNode;
+
+class Profiler {
+public:
+  static Profiler& getInstance();
+
+  // starts accounting, and sampling every interval microseconds unless 0
+  void start(unsigned long interval);
+  void stop();
+#ifdef MYPY_NO_PROFILER
+  bool isEnabled() const { return false; }
+#else
+  bool isEnabled() const { return enabled; }
+#endif
+
+  // the source, to show the lines samples fall on
+  void setSource(const std::string& text);
+  // the line a statement starts on
+  void setLine(const Node* stmt, int line) { lines[stmt] = line; }
+  int lineOf(const Node* stmt) const {
+    std::unordered_map<const Node*, int>::const_iterator it = lines.find(stmt);
+    return it == lines.end() ? 0 : it->second;
+  }
+
+  void enter(const FuncNode*);
+  void leave();
+  // calls entered and not left, the top level included
+  unsigned long depth() const { return frames.size(); }
+  void unwindTo(unsigned long depth) {
+    while (frames.size() > depth) leave();
+  }
+  // the current call is about to run stmt, or line
+  void statement(const Node* stmt) { at(lineOf(stmt)); }
+  void at(int line) {
+    if (line) frames.back().line = line;
+    if (ticks) sample();
+  }
+
+  void report(std::ostream&) const;
+  // one line per distinct stack: frames from the outermost, then the count
+  void writeStacks(std::ostream&) const;
+
+  Profiler(const Profiler&) = delete;
+  Profiler& operator=(const Profiler&) = delete;
+private:
+  typedef std::chrono::steady_clock Clock;
+
+  Profiler() : enabled(false), interval(0), lines(), source(), frames(), stats(),
+    samples(), lineSamples(), totalSamples(0), started(), elapsed(0) {}
+
+  void sample();
+  static void tick(int);
+
+  struct Frame {
+    const FuncNode* func;  // nullptr for the top level
+    Clock::time_point start;
+    unsigned long bytes;   // allocated when the call started
+    unsigned long childNs;
+    unsigned long childBytes;
+    int line;
+  };
+  struct Stats {
+    unsigned long calls;
+    unsigned long inclusiveNs;
+    unsigned long exclusiveNs;
+    unsigned long inclusiveBytes;
+    unsigned long exclusiveBytes;
+    // activations on the stack: a recursive call's time is already
+    // part of the outermost one's
+    unsigned long active;
+  };
+  // (function, line) from the outermost call
+  typedef std::vector<std::pair<const FuncNode*, int> > Stack;
+
+  static volatile sig_atomic_t ticks;
+
+  bool enabled;
+  unsigned long interval;
+  std::unordered_map<const Node*, int> lines;
+  std::vector<std::string> source;
+  std::vector<Frame> frames;
+  std::map<const FuncNode*, Stats> stats;
+  std::map<Stack, unsigned long> samples;
+  std::map<int, unsigned long> lineSamples;
+  unsigned long totalSamples;
+  Clock::time_point started;
+  unsigned long elapsed;
+};
+
+// Leaves, when it goes, every call entered since it was made, as
+// ScopeGuard pops their frames.
+class ProfileGuard {
+public:
+  explicit ProfileGuard(Profiler& p) : profiler(p), depth(p.depth()) {}
+  ~ProfileGuard() { profiler.unwindTo(depth); }
+  ProfileGuard(const ProfileGuard&) = delete;
+  ProfileGuard& operator=(const ProfileGuard&) = delete;
+private:
+  Profiler& profiler;
+  unsigned long depth;
+};
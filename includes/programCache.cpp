@@ -0,0 +1,413 @@
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "programCache.h"
+#include "ast.h"
+#include "bigint.h"
+#include "constants.h"
+#include "gc.h"
+
+namespace {
+
+// what every cache file starts with
+const char magic[8] = {'M', 'Y', 'P', 'Y', 'C', 0, 0, 2};
+// a cache is only trusted by a build of the same sources (see Makefile)
+#ifndef MYPY_BUILD_ID
+#error "MYPY_BUILD_ID, the checksum of the sources, is defined by the Makefile"
+#endif
+const char* const buildId = MYPY_BUILD_ID;
+
+unsigned long fnv1a(const char* s, unsigned long n) {
+  unsigned long h = 14695981039346656037UL;
+  for (unsigned long i = 0; i < n; ++i) {
+    h ^= static_cast<unsigned char>(s[i]);
+    h *= 1099511628211UL;
+  }
+  return h;
+}
+
+// foo.py -> foo.mpyc, anything else gets .mpyc appended
+std::string cachePath(const std::string& source) {
+  const std::string ext(".py");
+  if (source.size() > ext.size() && source.compare(source.size() - ext.size(), ext.size(), ext) == 0) {
+    return source.substr(0, source.size() - ext.size()) + ".mpyc";
+  }
+  return source + ".mpyc";
+}
+
+const std::string corrupt("corrupt program cache");
+
+class ProgramReader {
+public:
+  ProgramReader(const char* begin, const char* end) : p(begin), last(end) {}
+
+  unsigned char byte() {
+    need(1);
+    return static_cast<unsigned char>(*p++);
+  }
+  unsigned long word() {
+    unsigned long w;
+    need(sizeof(w));
+    std::memcpy(&w, p, sizeof(w));
+    p += sizeof(w);
+    return w;
+  }
+  std::string text() {
+    const unsigned long n = word();
+    need(n);
+    std::string res(p, n);
+    p += n;
+    return res;
+  }
+  const char* position() const { return p; }
+  bool atEnd() const { return p == last; }
+  void skip(unsigned long n) {
+    need(n);
+    p += n;
+  }
+
+  Node* node();
+
+  ProgramReader(const ProgramReader&) = delete;
+  ProgramReader& operator=(const ProgramReader&) = delete;
+private:
+  void need(unsigned long n) const {
+    if (static_cast<unsigned long>(last - p) < n) throw corrupt;
+  }
+  const Atom* atom() {
+    const std::string name = text();
+    return Interner::getInstance().intern(name);
+  }
+  Literal* literal();
+  template <class T> Node* binary() {
+    Node* left = node();
+    Node* right = node();
+    if (!left || !right) throw corrupt;
+    return PoolOfNodes::getInstance().make<T>(left, right);
+  }
+
+  const char* p;
+  const char* const last;
+};
+
+Literal* ProgramReader::literal() {
+  ConstantPool& constants = ConstantPool::getInstance();
+  switch (byte()) {
+    case Value::NONE: return constants.none();
+    case Value::BOOL: return constants.boolean(byte() != 0);
+    case Value::INT: return constants.integer(static_cast<long>(word()));
+    case Value::FLOAT: {
+      const unsigned long bits = word();
+      double f;
+      std::memcpy(&f, &bits, sizeof(f));
+      return constants.number(f);
+    }
+    case Value::STR: {
+      const std::string s = text();
+      return constants.string(s.data(), s.size());
+    }
+    case Value::LONG: {
+      const bool negative = byte() != 0;
+      const std::string s = text();
+      const BigInt n = BigInt::parse(s.data(), s.size());
+      return constants.integer(negative ? -n : n);
+    }
+    default: throw corrupt;
+  }
+}
+
+// the order of the reads matters, so every field goes through a local
+Node* ProgramReader::node() {
+  PoolOfNodes& pool = PoolOfNodes::getInstance();
+  switch (byte()) {
+    case ProgramWriter::NONE: return nullptr;
+    case ProgramWriter::LITERAL: return literal();
+    case ProgramWriter::IDENT: return pool.make<IdentNode>(atom());
+    case ProgramWriter::NULL_NODE: return NullNode::getInstance();
+    case ProgramWriter::PRINT: return pool.make<PrintNode>(node());
+    case ProgramWriter::IF: {
+      Node* cmp = node();
+      Node* ifBranch = node();
+      Node* elseBranch = node();
+      return pool.make<IfNode>(cmp, ifBranch, elseBranch);
+    }
+    case ProgramWriter::SUITE: {
+      SuiteNode* suite = pool.make<SuiteNode>();
+      for (unsigned long n = word(); n > 0; --n) {
+        suite->append(node());
+      }
+      return suite;
+    }
+    case ProgramWriter::FUNC: {
+      const Atom* name = atom();
+      Node* params = node();
+      Node* suite = node();
+      return pool.make<FuncNode>(name, params, suite);
+    }
+    case ProgramWriter::PARAMS: {
+      ParamNode* params = pool.make<ParamNode>();
+      for (unsigned long n = word(); n > 0; --n) {
+        params->append(node());
+      }
+      return params;
+    }
+    case ProgramWriter::CALL: {
+      const Atom* name = atom();
+      Node* args = node();
+      return pool.make<CallNode>(name, args);
+    }
+    case ProgramWriter::RETURN: return pool.make<ReturnNode>(node());
+    case ProgramWriter::UNARY: {
+      const char op = static_cast<char>(byte());
+      Node* operand = node();
+      if (!operand) throw corrupt;
+      return pool.make<UnaryNode>(op, operand);
+    }
+    case ProgramWriter::ASSIGN: return binary<AsgBinaryNode>();
+    case ProgramWriter::ADD: return binary<AddBinaryNode>();
+    case ProgramWriter::SUB: return binary<SubBinaryNode>();
+    case ProgramWriter::MUL: return binary<MulBinaryNode>();
+    case ProgramWriter::DIV: return binary<DivBinaryNode>();
+    case ProgramWriter::INT_DIV: return binary<IntDivBinaryNode>();
+    case ProgramWriter::MOD: return binary<ModBinaryNode>();
+    case ProgramWriter::EXP: return binary<ExpBinaryNode>();
+    case ProgramWriter::LESS: return binary<LessBinaryNode>();
+    case ProgramWriter::GREATER: return binary<GreaterBinaryNode>();
+    case ProgramWriter::EQUAL: return binary<EqualBinaryNode>();
+    case ProgramWriter::GRT_EQ: return binary<GrtEqBinaryNode>();
+    case ProgramWriter::LESS_EQ: return binary<LessEqBinaryNode>();
+    default: throw corrupt;
+  }
+}
+
+}
+
+ProgramCache& ProgramCache::getInstance() {
+  static thread_local ProgramCache cache;
+  return cache;
+}
+
+void ProgramCache::open(const std::string& source, const char* text, unsigned long size) {
+  path = cachePath(source);
+  sourceSize = size;
+  sourceHash = fnv1a(text, size);
+  recorded.clear();
+}
+
+void ProgramCache::close() {
+  path.clear();
+  recorded.clear();
+}
+
+bool ProgramCache::load(std::vector<Node*>& stmts) {
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) return false;
+  struct stat info;
+  if (fstat(fd, &info) != 0 || info.st_size == 0) {
+    ::close(fd);
+    return false;
+  }
+  const unsigned long size = info.st_size;
+  void* map = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (map == MAP_FAILED) return false;
+
+  const char* begin = static_cast<const char*>(map);
+  bool ok = false;
+  try {
+    ProgramReader in(begin, begin + size);
+    in.skip(sizeof(magic));
+    if (std::memcmp(begin, magic, sizeof(magic)) != 0) throw corrupt;
+    if (in.text() != buildId) throw corrupt;
+    if (in.word() != sourceSize || in.word() != sourceHash) throw corrupt;
+    const unsigned long payloadSize = in.word();
+    const unsigned long payloadHash = in.word();
+    if (static_cast<unsigned long>(begin + size - in.position()) != payloadSize ||
+        fnv1a(in.position(), payloadSize) != payloadHash) {
+      throw corrupt;
+    }
+    for (unsigned long n = in.word(); n > 0; --n) {
+      Node* stmt = in.node();
+      if (!stmt) throw corrupt;
+      stmts.push_back(stmt);
+    }
+    ok = in.atEnd();
+  }
+  catch (const std::string&) {
+    // nodes already made stay in the parse pool until it is drained
+  }
+  munmap(map, size);
+  if (!ok) stmts.clear();
+  return ok;
+}
+
+void ProgramCache::record(const Node* stmt) {
+  if (isOpen()) recorded.push_back(stmt);
+}
+
+void ProgramCache::save() const {
+  if (!isOpen()) return;
+  ProgramWriter payload;
+  try {
+    payload.word(recorded.size());
+    for (const Node* stmt : recorded) {
+      payload.node(stmt);
+    }
+  }
+  catch (const std::string&) {
+    return;  // a construct the format has no tag for
+  }
+
+  ProgramWriter header;
+  for (char c : magic) header.byte(c);
+  header.text(buildId);
+  header.word(sourceSize);
+  header.word(sourceHash);
+  header.word(payload.bytes().size());
+  header.word(fnv1a(payload.bytes().data(), payload.bytes().size()));
+
+  // written aside and renamed, so a reader never sees half a file
+  const std::string tmp = path + ".tmp";
+  FILE* file = fopen(tmp.c_str(), "wb");
+  if (!file) return;
+  const bool written =
+    fwrite(header.bytes().data(), 1, header.bytes().size(), file) == header.bytes().size() &&
+    fwrite(payload.bytes().data(), 1, payload.bytes().size(), file) == payload.bytes().size();
+  if (fclose(file) != 0 || !written || rename(tmp.c_str(), path.c_str()) != 0) {
+    remove(tmp.c_str());
+  }
+}
+
+void ProgramWriter::word(unsigned long w) {
+  out.append(reinterpret_cast<const char*>(&w), sizeof(w));
+}
+
+void ProgramWriter::text(const std::string& s) {
+  word(s.size());
+  out.append(s);
+}
+
+void ProgramWriter::node(const Node* n) {
+  if (n) {
+    n->save(*this);
+  } else {
+    tag(NONE);
+  }
+}
+
+// Serialization of the AST. Each node writes its tag and then its
+// fields in the order ProgramReader::node reads them back.
+
+void Node::save(ProgramWriter&) const {
+  throw std::string("SystemError: node cannot be cached");
+}
+
+void Literal::save(ProgramWriter& out) const {
+  out.tag(ProgramWriter::LITERAL);
+  out.byte(val.getType());
+  switch (val.getType()) {
+    case Value::NONE: break;
+    case Value::BOOL: out.byte(val.boolValue()); break;
+    case Value::INT: out.word(static_cast<unsigned long>(val.getInt())); break;
+    case Value::FLOAT: {
+      const double f = val.getFloat();
+      unsigned long bits;
+      std::memcpy(&bits, &f, sizeof(bits));
+      out.word(bits);
+      break;
+    }
+    case Value::STR: out.text(std::string(val.getStr()->chars(), val.getStr()->length())); break;
+    case Value::LONG: {
+      // the sign, then the decimal digits
+      const std::string digits = val.str();
+      out.byte(digits[0] == '-');
+      out.text(digits[0] == '-' ? digits.substr(1) : digits);
+      break;
+    }
+    default: throw std::string("SystemError: node cannot be cached");
+  }
+}
+
+void IdentNode::save(ProgramWriter& out) const {
+  out.tag(ProgramWriter::IDENT);
+  out.text(ident->str());
+}
+
+void NullNode::save(ProgramWriter& out) const {
+  out.tag(ProgramWriter::NULL_NODE);
+}
+
+void PrintNode::save(ProgramWriter& out) const {
+  out.tag(ProgramWriter::PRINT);
+  out.node(node);
+}
+
+void IfNode::save(ProgramWriter& out) const {
+  out.tag(ProgramWriter::IF);
+  out.node(comparison);
+  out.node(ifBranch);
+  out.node(elseBranch);
+}
+
+void SuiteNode::save(ProgramWriter& out) const {
+  out.tag(ProgramWriter::SUITE);
+  out.word(stmts.size());
+  for (const Node* stmt : stmts) {
+    out.node(stmt);
+  }
+}
+
+void FuncNode::save(ProgramWriter& out) const {
+  out.tag(ProgramWriter::FUNC);
+  out.text(name->str());
+  out.node(params);
+  out.node(suite);
+}
+
+void ParamNode::save(ProgramWriter& out) const {
+  out.tag(ProgramWriter::PARAMS);
+  out.word(params.size());
+  for (const Node* param : params) {
+    out.node(param);
+  }
+}
+
+void CallNode::save(ProgramWriter& out) const {
+  out.tag(ProgramWriter::CALL);
+  out.text(funcName->str());
+  out.node(arguments);
+}
+
+void ReturnNode::save(ProgramWriter& out) const {
+  out.tag(ProgramWriter::RETURN);
+  out.node(testlist);
+}
+
+void UnaryNode::save(ProgramWriter& out) const {
+  out.tag(ProgramWriter::UNARY);
+  out.byte(op);
+  out.node(node);
+}
+
+void BinaryNode::saveOperands(ProgramWriter& out, unsigned char tag) const {
+  out.byte(tag);
+  out.node(left);
+  out.node(right);
+}
+
+void AsgBinaryNode::save(ProgramWriter& out) const { saveOperands(out, ProgramWriter::ASSIGN); }
+void AddBinaryNode::save(ProgramWriter& out) const { saveOperands(out, ProgramWriter::ADD); }
+void SubBinaryNode::save(ProgramWriter& out) const { saveOperands(out, ProgramWriter::SUB); }
+void MulBinaryNode::save(ProgramWriter& out) const { saveOperands(out, ProgramWriter::MUL); }
+void DivBinaryNode::save(ProgramWriter& out) const { saveOperands(out, ProgramWriter::DIV); }
+void IntDivBinaryNode::save(ProgramWriter& out) const { saveOperands(out, ProgramWriter::INT_DIV); }
+void ModBinaryNode::save(ProgramWriter& out) const { saveOperands(out, ProgramWriter::MOD); }
+void ExpBinaryNode::save(ProgramWriter& out) const { saveOperands(out, ProgramWriter::EXP); }
+void LessBinaryNode::save(ProgramWriter& out) const { saveOperands(out, ProgramWriter::LESS); }
+void GreaterBinaryNode::save(ProgramWriter& out) const { saveOperands(out, ProgramWriter::GREATER); }
+void EqualBinaryNode::save(ProgramWriter& out) const { saveOperands(out, ProgramWriter::EQUAL); }
+void GrtEqBinaryNode::save(ProgramWriter& out) const { saveOperands(out, ProgramWriter::GRT_EQ); }
+void LessEqBinaryNode::save(ProgramWriter& out) const { saveOperands(out, ProgramWriter::LESS_EQ); }
@@ -0,0 +1,72 @@
+#pragma once
+
+//  Precompiled programs. After a script has been parsed and run to the
+//  end, its top-level statements (already folded) are written next to
+//  it, in foo.mpyc for foo.py. A later run of the same source by the
+//  same build maps that file and rebuilds the AST straight from it,
+//  without scanning or parsing.
+//
+//  The file is a header followed by the statements, each node in
+//  preorder as a tag byte and its fields. Nothing in it is a pointer:
+//  names and strings are stored by value and interned again on
+//  loading. The header holds the source's size and hash, the
+//  interpreter's build id and a hash of the payload. The build id is a
+//  checksum of the interpreter's sources, made by the Makefile, so a
+//  change to the nodes, the folder or the value kernels retires every
+//  cache written before it. A file that does not match, or that does
+//  not decode cleanly, is ignored and the source is parsed as usual.
+
+#include <string>
+#include <vector>
+
+class Node;
+class ProgramWriter;
+
+class ProgramCache {
+public:
+  static ProgramCache& getInstance();
+
+  // the cache for the program in source, whose text is given; caching
+  // stays off for a program read from stdin
+  void open(const std::string& source, const char* text, unsigned long size);
+  bool isOpen() const { return !path.empty(); }
+  // done with the program: nothing more is recorded until the next open
+  void close();
+
+  // the statements of the cached program, false if there is no usable cache
+  bool load(std::vector<Node*>& stmts);
+  // the parser hands over each top-level statement as it is run
+  void record(const Node* stmt);
+  // writes the recorded statements, once the whole program has run
+  void save() const;
+
+  ProgramCache(const ProgramCache&) = delete;
+  ProgramCache& operator=(const ProgramCache&) = delete;
+private:
+  ProgramCache() : path(), sourceSize(0), sourceHash(0), recorded() {}
+
+  std::string path;
+  unsigned long sourceSize;
+  unsigned long sourceHash;
+  std::vector<const Node*> recorded;
+};
+
+// Serializes nodes into a byte buffer, see Node::save.
+class ProgramWriter {
+public:
+  enum Tag : unsigned char {
+    NONE, LITERAL, IDENT, NULL_NODE, PRINT, IF, SUITE, FUNC, PARAMS, CALL,
+    RETURN, UNARY, ASSIGN, ADD, SUB, MUL, DIV, INT_DIV, MOD, EXP,
+    LESS, GREATER, EQUAL, GRT_EQ, LESS_EQ, NUM_TAGS
+  };
+  ProgramWriter() : out() {}
+
+  void tag(Tag t) { byte(t); }
+  void byte(unsigned char b) { out.push_back(static_cast<char>(b)); }
+  void word(unsigned long w);
+  void text(const std::string&);
+  void node(const Node*);
+  const std::string& bytes() const { return out; }
+private:
+  std::string out;
+};
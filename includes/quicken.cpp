@@ -0,0 +1,93 @@
+#include <iostream>
+#include "quicken.h"
+#include "node.h"
+
+namespace {
+
+const char* const opName[Value::NUM_OPS] = {
+  "Add", "Sub", "Mul", "Div", "IntDiv", "Mod", "Pow", "Lt", "Gt", "Eq", "Ge", "Le"
+};
+
+bool hasKernel(TypeFeedback::State state, Value::Op op) {
+  switch (state) {
+    case TypeFeedback::INT_INT:
+      return op != Value::POW;
+    case TypeFeedback::FLOAT_FLOAT:
+      return op != Value::INT_DIV && op != Value::MOD && op != Value::POW;
+    default:
+      return false;
+  }
+}
+
+}
+
+void TypeFeedback::observe(Value::Op op, Value::Type x, Value::Type y, const Node* site) {
+  Quickening& quickening = Quickening::getInstance();
+  if (quickening.getWarmup() == 0) {
+    state = GENERIC;
+    return;
+  }
+  if (count == 0 || x != left || y != right) {
+    left = x;
+    right = y;
+    count = 0;
+  }
+  if (++count < quickening.getWarmup()) return;
+
+  count = 0;
+  if (x == Value::INT && y == Value::INT) {
+    state = INT_INT;
+  } else if (x == Value::FLOAT && y == Value::FLOAT) {
+    state = FLOAT_FLOAT;
+  } else {
+    state = GENERIC;
+  }
+  if (!hasKernel(state, op)) state = GENERIC;
+  if (!listed) {
+    quickening.enlist(site, this, op);
+    listed = true;
+  }
+}
+
+void TypeFeedback::deoptimize() {
+  ++deopts;
+  state = deopts < Quickening::maxDeopts ? WARMING : GENERIC;
+}
+
+Quickening& Quickening::getInstance() {
+  static thread_local Quickening quickening;
+  return quickening;
+}
+
+void Quickening::enlist(const Node* site, const TypeFeedback* feedback, Value::Op op) {
+  sites.push_back(Site{site, feedback, op});
+}
+
+void Quickening::dump(std::ostream& out) const {
+  unsigned long specialized = 0;
+  for (const Site& site : sites) {
+    const TypeFeedback& feedback = *site.feedback;
+    out << "quicken: ";
+    switch (feedback.getState()) {
+      case TypeFeedback::INT_INT:
+        out << "Int" << opName[site.op] << "Int";
+        ++specialized;
+        break;
+      case TypeFeedback::FLOAT_FLOAT:
+        out << "Float" << opName[site.op] << "Float";
+        ++specialized;
+        break;
+      case TypeFeedback::WARMING:
+        out << "warming";
+        break;
+      case TypeFeedback::GENERIC:
+        out << "generic";
+        break;
+    }
+    out << ' ';
+    site.node->dump(out);
+    out << ": " << feedback.getHits() << " hits, " << feedback.getDeopts() << " deopts" << std::endl;
+  }
+  out << "quicken: " << specialized << " of " << sites.size()
+      << " warmed up sites specialized (warm-up " << warmup << ")" << std::endl;
+}
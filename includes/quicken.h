@@ -0,0 +1,171 @@
+#pragma once
+
+//  Type feedback for the arithmetic and comparison nodes. Each node
+//  watches the types of its operands while it warms up; once it has
+//  seen the same pair enough times in a row it specializes for it.
+//  A specialized node (IntAddInt, FloatLtFloat, ...) computes the
+//  result inline behind a guard on the two operand types. When the
+//  guard fails the node falls back to Value::binary and starts warming
+//  up again, and after too many such deopts it stays generic.
+//
+//  Specialized kernels only exist where one is shorter than the
+//  generic path: int by int except **, and float by float for + - *
+//  / and the comparisons. Whatever the inline kernel cannot do (an
+//  int result that overflows into a long, a division by zero) takes
+//  the generic path without deopting.
+
+#include <iosfwd>
+#include <vector>
+#include "value.h"
+
+class Node;
+
+class TypeFeedback {
+public:
+  enum State { WARMING, INT_INT, FLOAT_FLOAT, GENERIC };
+
+  TypeFeedback() :
+    state(WARMING), left(Value::UNDEF), right(Value::UNDEF), count(0),
+    hits(0), deopts(0), listed(false) {}
+
+  // x OP y, for the node site
+  template <Value::Op OP>
+  Value apply(const Value& x, const Value& y, const Node* site) {
+    Value res;
+    switch (state) {
+      case INT_INT:
+        if (x.getType() == Value::INT && y.getType() == Value::INT) {
+          if (intKernel<OP>(x.getInt(), y.getInt(), res)) {
+            ++hits;
+            return res;
+          }
+          break;
+        }
+        deoptimize();
+        break;
+      case FLOAT_FLOAT:
+        if (x.getType() == Value::FLOAT && y.getType() == Value::FLOAT) {
+          if (floatKernel<OP>(x.getFloat(), y.getFloat(), res)) {
+            ++hits;
+            return res;
+          }
+          break;
+        }
+        deoptimize();
+        break;
+      case WARMING:
+        observe(OP, x.getType(), y.getType(), site);
+        break;
+      case GENERIC:
+        break;
+    }
+    return Value::binary(OP, x, y);
+  }
+
+  State getState() const { return state; }
+  unsigned long getHits() const { return hits; }
+  unsigned long getDeopts() const { return deopts; }
+
+private:
+  void observe(Value::Op, Value::Type, Value::Type, const Node* site);
+  void deoptimize();
+
+  template <Value::Op OP>
+  static bool intKernel(long x, long y, Value& res) {
+    switch (OP) {
+      case Value::ADD: {
+        long sum;
+        if (__builtin_add_overflow(x, y, &sum)) return false;
+        res = Value(sum);
+        return true;
+      }
+      case Value::SUB: {
+        long diff;
+        if (__builtin_sub_overflow(x, y, &diff)) return false;
+        res = Value(diff);
+        return true;
+      }
+      case Value::MUL: {
+        long prod;
+        if (__builtin_mul_overflow(x, y, &prod)) return false;
+        res = Value(prod);
+        return true;
+      }
+      case Value::DIV:
+      case Value::INT_DIV:
+        if (y == 0 || y == -1) return false;
+        res = Value(x / y - ((x % y != 0) && ((x < 0) != (y < 0))));
+        return true;
+      case Value::MOD:
+        if (y == 0 || y == -1) return false;
+        {
+          const long r = x % y;
+          res = Value(r != 0 && ((r < 0) != (y < 0)) ? r + y : r);
+        }
+        return true;
+      case Value::LT: res = Value::boolean(x < y); return true;
+      case Value::GT: res = Value::boolean(x > y); return true;
+      case Value::EQ: res = Value::boolean(x == y); return true;
+      case Value::GE: res = Value::boolean(x >= y); return true;
+      case Value::LE: res = Value::boolean(x <= y); return true;
+      default: return false;
+    }
+  }
+
+  template <Value::Op OP>
+  static bool floatKernel(double x, double y, Value& res) {
+    switch (OP) {
+      case Value::ADD: res = Value(x + y); return true;
+      case Value::SUB: res = Value(x - y); return true;
+      case Value::MUL: res = Value(x * y); return true;
+      case Value::DIV:
+        if (y == 0) return false;
+        res = Value(x / y);
+        return true;
+      case Value::LT: res = Value::boolean(x < y); return true;
+      case Value::GT: res = Value::boolean(x > y); return true;
+      case Value::EQ: res = Value::boolean(x == y); return true;
+      case Value::GE: res = Value::boolean(x >= y); return true;
+      case Value::LE: res = Value::boolean(x <= y); return true;
+      default: return false;
+    }
+  }
+
+  State state;
+  // while warming up: the operand types of the current run and its length
+  Value::Type left;
+  Value::Type right;
+  unsigned long count;
+  unsigned long hits;
+  unsigned long deopts;
+  bool listed;  // known to Quickening
+};
+
+// The sites that have left warm-up, for --dump-quick.
+class Quickening {
+public:
+  static Quickening& getInstance();
+
+  // evaluations of one operand type pair before a site specializes,
+  // 0 keeps every site generic
+  void setWarmup(unsigned long n) { warmup = n; }
+  unsigned long getWarmup() const { return warmup; }
+  static const unsigned long maxDeopts = 4;
+
+  void enlist(const Node* site, const TypeFeedback* feedback, Value::Op);
+  void dump(std::ostream&) const;
+
+  Quickening(const Quickening&) = delete;
+  Quickening& operator=(const Quickening&) = delete;
+private:
+  Quickening() : warmup(16), sites() {}
+
+  struct Site {
+    const Node* node;
+    const TypeFeedback* feedback;
+    Value::Op op;
+  };
+
+  unsigned long warmup;
+  std::vector<Site> sites;
+};
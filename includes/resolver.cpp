@@ -0,0 +1,122 @@
+#include "resolver.h"
+#include "ast.h"
+
+Resolver& Resolver::getInstance() {
+  static thread_local Resolver resolver;
+  return resolver;
+}
+
+Resolver::Resolver() : scopes(), globals(), declaring(false) {
+  TableManager& tm = TableManager::getInstance();
+  Interner& interner = Interner::getInstance();
+  tm.setGlobal(global(interner.intern("None")), Value());
+  tm.setGlobal(global(interner.intern("True")), Value::boolean(true));
+  tm.setGlobal(global(interner.intern("False")), Value::boolean(false));
+}
+
+void Resolver::resolve(Node* stmt) {
+  if (stmt) stmt->resolve(*this);
+}
+
+void Resolver::resolveFunction(FuncNode& func) {
+  scopes.push_back(std::map<const Atom*, int>());
+  declaring = true;
+  for (const Node* param : func.getParams()) {
+    declare(static_cast<const IdentNode*>(param)->getAtom());
+  }
+  resolve(func.getSuite());
+  declaring = false;
+  resolve(func.getSuite());
+  func.setFrameSize(scopes.back().size());
+  scopes.pop_back();
+}
+
+void Resolver::declare(const Atom* name) {
+  std::map<const Atom*, int>& locals = scopes.back();
+  if (locals.find(name) == locals.end()) {
+    const int slot = locals.size();
+    locals[name] = slot;
+  }
+}
+
+Location Resolver::lookup(const Atom* name) {
+  for (unsigned long depth = 0; depth < scopes.size(); ++depth) {
+    const std::map<const Atom*, int>& locals = scopes[scopes.size() - 1 - depth];
+    std::map<const Atom*, int>::const_iterator it = locals.find(name);
+    if (it != locals.end()) {
+      return Location{depth ? Location::ENCLOSING : Location::LOCAL, static_cast<int>(depth), it->second};
+    }
+  }
+  return Location{Location::GLOBAL, 0, global(name)};
+}
+
+int Resolver::global(const Atom* name) {
+  std::map<const Atom*, int>::const_iterator it = globals.find(name);
+  if (it != globals.end()) {
+    return it->second;
+  }
+  const int slot = globals.size();
+  globals[name] = slot;
+  TableManager::getInstance().reserveGlobals(globals.size());
+  return slot;
+}
+
+// Resolution of the AST. References are bound on the second pass over
+// a function body, assignments declare locals on the first.
+
+void IdentNode::resolve(Resolver& r) {
+  if (!r.isDeclaring()) loc = r.lookup(ident);
+}
+
+void PrintNode::resolve(Resolver& r) {
+  if (node) node->resolve(r);
+}
+
+void IfNode::resolve(Resolver& r) {
+  if (comparison) comparison->resolve(r);
+  if (ifBranch) ifBranch->resolve(r);
+  if (elseBranch) elseBranch->resolve(r);
+}
+
+void SuiteNode::resolve(Resolver& r) {
+  for (Node* stmt : stmts) {
+    if (stmt) stmt->resolve(r);
+  }
+}
+
+void FuncNode::resolve(Resolver& r) {
+  // a nested def is resolved with the enclosing locals already known
+  if (!r.isDeclaring()) r.resolveFunction(*this);
+}
+
+void ParamNode::resolve(Resolver& r) {
+  for (Node* param : params) {
+    param->resolve(r);
+  }
+}
+
+void CallNode::resolve(Resolver& r) {
+  if (arguments) arguments->resolve(r);
+}
+
+void ReturnNode::resolve(Resolver& r) {
+  if (testlist) testlist->resolve(r);
+}
+
+void UnaryNode::resolve(Resolver& r) {
+  node->resolve(r);
+}
+
+void BinaryNode::resolve(Resolver& r) {
+  if (left) left->resolve(r);
+  if (right) right->resolve(r);
+}
+
+void AsgBinaryNode::resolve(Resolver& r) {
+  if (right) right->resolve(r);
+  if (r.isDeclaring()) {
+    r.declare(getAtom());
+  } else {
+    static_cast<IdentNode*>(left)->resolve(r);
+  }
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+//  Static scope resolution. Every top-level statement goes through the
+//  resolver before it runs, and each variable reference in it is bound
+//  to a Location: a slot in the current frame, a slot in the frame of
+//  an enclosing function, or a global slot. Functions themselves are
+//  still found by name.
+//
+//  As in Python, a name is local to a function if the function assigns
+//  to it anywhere in its body or takes it as a parameter. Names that
+//  are not local to any enclosing function are global.
+
+#include <map>
+#include <string>
+#include <vector>
+
+class Atom;
+class Node;
+class FuncNode;
+
+struct Location {
+  enum Kind { UNRESOLVED, LOCAL, ENCLOSING, GLOBAL };
+  Kind kind;
+  int depth;  // ENCLOSING: number of frames to follow up the static chain
+  int slot;
+};
+
+class Resolver {
+public:
+  static Resolver& getInstance();
+
+  void resolve(Node* stmt);
+  // a def: parameters and assigned names become the frame's slots
+  void resolveFunction(FuncNode&);
+
+  // while a function body is being scanned for locals, references are
+  // not resolved yet and assignments only declare their target
+  bool isDeclaring() const { return declaring; }
+  void declare(const Atom*);
+  Location lookup(const Atom*);
+
+  // the global slot of a builtin or module-level name
+  int global(const Atom*);
+
+  Resolver(const Resolver&) = delete;
+  Resolver& operator=(const Resolver&) = delete;
+private:
+  Resolver();
+
+  // locals of the functions being resolved, innermost last
+  std::vector<std::map<const Atom*, int> > scopes;
+  std::map<const Atom*, int> globals;
+  bool declaring;
+};
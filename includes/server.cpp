@@ -0,0 +1,305 @@
+#include <arpa/inet.h>
+#include <cerrno>
+#include <csignal>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <streambuf>
+#include <thread>
+#include <vector>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "server.h"
+#include "poolOfNodes.h"
+
+namespace {
+
+// the largest request taken, a script or a path
+const uint32_t maxRequest = 64u << 20;
+
+bool readAll(int fd, char* to, size_t bytes) {
+  while (bytes) {
+    const ssize_t got = read(fd, to, bytes);
+    if (got < 0 && errno == EINTR) continue;
+    if (got <= 0) return false;
+    to += got;
+    bytes -= got;
+  }
+  return true;
+}
+
+// the header and the payload in one write, if the socket takes it
+bool sendChunk(int fd, char type, const void* data, uint32_t length) {
+  char header[5];
+  header[0] = type;
+  const uint32_t size = htonl(length);
+  std::memcpy(header + 1, &size, 4);
+  struct iovec parts[2] = { { header, 5 }, { const_cast<void*>(data), length } };
+  struct iovec* part = parts;
+  int count = 2;
+  while (count) {
+    struct msghdr message = msghdr();
+    message.msg_iov = part;
+    message.msg_iovlen = count;
+    // a client that has gone is an error, not a SIGPIPE
+    ssize_t sent = sendmsg(fd, &message, MSG_NOSIGNAL);
+    if (sent < 0 && errno == EINTR) continue;
+    if (sent < 0) return false;
+    for (; count && static_cast<size_t>(sent) >= part->iov_len; ++part, --count) {
+      sent -= part->iov_len;
+    }
+    if (count) {
+      part->iov_base = static_cast<char*>(part->iov_base) + sent;
+      part->iov_len -= sent;
+    }
+  }
+  return true;
+}
+
+bool readChunk(int fd, char& type, std::string& payload, uint32_t limit) {
+  char header[5];
+  if (!readAll(fd, header, 5)) return false;
+  uint32_t size;
+  std::memcpy(&size, header + 1, 4);
+  size = ntohl(size);
+  if (size > limit) return false;
+  type = header[0];
+  payload.resize(size);
+  return readAll(fd, &payload[0], size);
+}
+
+// an ostream's buffer that sends what is written as chunks of one type,
+// when full and on each flush. Once the client has gone, what follows
+// is dropped, and the script runs on to its end.
+class ChunkBuffer : public std::streambuf {
+public:
+  ChunkBuffer(int fd, char type) : fd(fd), type(type), gone(false), buffer() {
+    setp(buffer, buffer + sizeof buffer);
+  }
+protected:
+  int overflow(int c) {
+    send();
+    if (c != traits_type::eof()) {
+      *pptr() = traits_type::to_char_type(c);
+      pbump(1);
+    }
+    return traits_type::not_eof(c);
+  }
+  int sync() {
+    send();
+    return 0;
+  }
+private:
+  void send() {
+    if (pptr() > pbase() && !gone) {
+      gone = !sendChunk(fd, type, pbase(), pptr() - pbase());
+    }
+    setp(buffer, buffer + sizeof buffer);
+  }
+
+  int fd;
+  char type;
+  bool gone;
+  char buffer[4096];
+};
+
+bool address(const std::string& path, struct sockaddr_un& to, std::ostream& err) {
+  to = sockaddr_un();
+  to.sun_family = AF_UNIX;
+  if (path.empty() || path.size() >= sizeof to.sun_path) {
+    err << "serve: bad socket path \"" << path << "\"" << std::endl;
+    return false;
+  }
+  std::memcpy(to.sun_path, path.c_str(), path.size() + 1);
+  return true;
+}
+
+int connectTo(const struct sockaddr_un& to) {
+  const int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (fd >= 0 && connect(fd, reinterpret_cast<const struct sockaddr*>(&to), sizeof to) != 0) {
+    const int reason = errno;
+    close(fd);
+    errno = reason;
+    return -1;
+  }
+  return fd;
+}
+
+}
+
+Server::Server(const std::string& path, unsigned long workers,
+               const Interpreter::Options& options) :
+  path(path), workers(workers ? workers : 1), options(options), listener(-1),
+  lock(), waiting(), stopping(false) {}
+
+int Server::serve() {
+  // taken by sigwait below; every thread started from here on has them
+  // blocked too
+  sigset_t stops;
+  sigemptyset(&stops);
+  sigaddset(&stops, SIGINT);
+  sigaddset(&stops, SIGTERM);
+  pthread_sigmask(SIG_BLOCK, &stops, nullptr);
+  if (!listen()) return EXIT_FAILURE;
+
+  std::vector<std::thread> threads;
+  for (unsigned long i = 0; i < workers; ++i) {
+    threads.emplace_back(&Server::work, this);
+  }
+  int signal;
+  sigwait(&stops, &signal);
+  {
+    std::lock_guard<std::mutex> hold(lock);
+    stopping = true;
+    // wakes the workers waiting in accept, and those waiting on a client
+    shutdown(listener, SHUT_RDWR);
+    for (int connection : waiting) {
+      shutdown(connection, SHUT_RDWR);
+    }
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  close(listener);
+  unlink(path.c_str());
+  return EXIT_SUCCESS;
+}
+
+bool Server::listen() {
+  struct sockaddr_un to;
+  if (!address(path, to, std::cerr)) return false;
+  // a socket left by a server that was killed is replaced, a live one is not
+  struct stat st;
+  if (lstat(path.c_str(), &st) == 0 && S_ISSOCK(st.st_mode)) {
+    const int live = connectTo(to);
+    if (live >= 0) {
+      close(live);
+      std::cerr << "serve: a server is already running on " << path << std::endl;
+      return false;
+    }
+    unlink(path.c_str());
+  }
+  listener = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (listener < 0) {
+    std::cerr << "serve: " << std::strerror(errno) << std::endl;
+    return false;
+  }
+  const mode_t mask = umask(0077);
+  const bool bound = bind(listener, reinterpret_cast<struct sockaddr*>(&to), sizeof to) == 0;
+  umask(mask);
+  if (!bound || ::listen(listener, SOMAXCONN) != 0) {
+    std::cerr << "serve: " << path << ": " << std::strerror(errno) << std::endl;
+    close(listener);
+    return false;
+  }
+  return true;
+}
+
+void Server::work() {
+  for (;;) {
+    const int connection = accept4(listener, nullptr, nullptr, SOCK_CLOEXEC);
+    if (connection < 0) {
+      if (errno == EINTR || errno == ECONNABORTED) continue;
+      // shut down
+      return;
+    }
+    // for reading the request, and for each chunk of the response
+    const struct timeval timeout = { clientTimeout, 0 };
+    setsockopt(connection, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof timeout);
+    setsockopt(connection, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof timeout);
+    answer(connection);
+    close(connection);
+  }
+}
+
+void Server::answer(int connection) {
+  char kind;
+  std::string payload;
+  ChunkBuffer outBuffer(connection, OUTPUT), errBuffer(connection, ERRORS);
+  std::ostream out(&outBuffer), err(&errBuffer);
+  int status = EXIT_FAILURE;
+  if (!receive(connection, kind, payload)) {
+    err << "serve: no request" << std::endl;
+  }
+  else if (kind != TEXT && kind != PATH) {
+    err << "serve: bad request" << std::endl;
+  }
+  else {
+    std::thread([&]() {
+      Interpreter& interpreter = Interpreter::getInstance();
+      interpreter.configure(options);
+      interpreter.setOutput(out);
+      interpreter.setErrors(err);
+      if (kind == PATH) {
+        status = interpreter.run(payload.c_str());
+      }
+      else {
+        std::vector<Node*> stmts;
+        status = interpreter.compile(payload.data(), payload.size(), stmts);
+        if (status == EXIT_SUCCESS) status = interpreter.execute(stmts);
+      }
+      PoolOfNodes::getInstance().drainThePool();
+    }).join();
+  }
+  out.flush();
+  err.flush();
+  const uint32_t code = htonl(status);
+  sendChunk(connection, EXIT, &code, 4);
+}
+
+bool Server::receive(int connection, char& kind, std::string& payload) {
+  {
+    std::lock_guard<std::mutex> hold(lock);
+    if (stopping) return false;
+    waiting.insert(connection);
+  }
+  const bool received = readChunk(connection, kind, payload, maxRequest);
+  std::lock_guard<std::mutex> hold(lock);
+  waiting.erase(connection);
+  return received;
+}
+
+int Server::request(const std::string& path, Chunk kind, const std::string& payload,
+                    std::ostream& out, std::ostream& err) {
+  struct sockaddr_un to;
+  if (!address(path, to, err)) return -1;
+  const int fd = connectTo(to);
+  if (fd < 0) {
+    err << "serve: cannot connect to " << path << ": " << std::strerror(errno) << std::endl;
+    return -1;
+  }
+  if (payload.size() > maxRequest || !sendChunk(fd, kind, payload.data(), payload.size())) {
+    err << "serve: cannot send the request" << std::endl;
+    close(fd);
+    return -1;
+  }
+  int status = EXIT_FAILURE;
+  char type;
+  std::string data;
+  for (;;) {
+    if (!readChunk(fd, type, data, ~0u)) {
+      err << "serve: the server closed the connection" << std::endl;
+      break;
+    }
+    if (type == OUTPUT) {
+      out.write(data.data(), data.size()).flush();
+    }
+    else if (type == ERRORS) {
+      err.write(data.data(), data.size()).flush();
+    }
+    else if (type == EXIT && data.size() == 4) {
+      uint32_t code;
+      std::memcpy(&code, data.data(), 4);
+      status = static_cast<int>(ntohl(code));
+      break;
+    }
+  }
+  close(fd);
+  return status;
+}
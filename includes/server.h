@@ -0,0 +1,71 @@
+#pragma once
+
+//  ./run --serve PATH: a resident interpreter on a Unix domain socket,
+//  for callers that would otherwise start a process per short script.
+//  The socket is made with only its owner able to connect, since a
+//  request runs arbitrary code with the server's rights.
+//
+//  A connection carries one request and its response, each a sequence
+//  of chunks: a type byte, a 32-bit length in network order and that
+//  many bytes. The request is one chunk, 's' with the text of a script
+//  or 'f' with a path the server can open (through its .mpyc, as ./run
+//  does). The response streams back 'o' chunks of what print writes,
+//  'e' chunks of syntax errors, and ends with 'x', the exit status as
+//  a 32-bit integer.
+//
+//  Worker threads, --jobs of them, take connections as they come. Each
+//  script runs on a fresh thread, so on a fresh interpreter of its own
+//  (see interpreter.h), and nothing carries over between requests.
+//  A client has clientTimeout to send its request, and to take each
+//  chunk of the response, so one that stalls cannot hold a worker.
+//
+//  SIGINT or SIGTERM stops the server once the running scripts are
+//  done, and removes the socket. Connections still waiting for their
+//  request are shut down.
+
+#include <iosfwd>
+#include <mutex>
+#include <set>
+#include <string>
+#include "interpreter.h"
+
+class Server {
+public:
+  enum Chunk : char {
+    TEXT = 's', PATH = 'f',                 // requests
+    OUTPUT = 'o', ERRORS = 'e', EXIT = 'x'  // responses
+  };
+
+  Server(const std::string& path, unsigned long workers, const Interpreter::Options& options);
+
+  // serves until signalled; the exit status for ./run
+  int serve();
+
+  // sends a request to the server on path and copies its response to
+  // out and err; the script's exit status, or -1, with the reason in
+  // err, if there was no server to answer
+  static int request(const std::string& path, Chunk kind, const std::string& payload,
+                     std::ostream& out, std::ostream& err);
+
+  // seconds
+  static const int clientTimeout = 10;
+
+  Server(const Server&) = delete;
+  Server& operator=(const Server&) = delete;
+private:
+  bool listen();
+  void work();
+  void answer(int connection);
+  // reads the request, unless the server is stopping or stops meanwhile
+  bool receive(int connection, char& kind, std::string& payload);
+
+  std::string path;
+  unsigned long workers;
+  Interpreter::Options options;
+  int listener;
+
+  // connections waiting for their request, shut down on a stop
+  std::mutex lock;
+  std::set<int> waiting;
+  bool stopping;
+};
@@ -0,0 +1,78 @@
+#include <cstdlib>
+#include <cstring>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "source.h"
+
+bool Source::open(FILE* file, bool map) {
+  close();
+  struct stat st;
+  const int fd = fileno(file);
+  if (map && fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && mapFile(fd, st.st_size)) {
+    return true;
+  }
+  return readFile(file);
+}
+
+bool Source::open(const char* from, unsigned long size) {
+  close();
+  text = static_cast<char*>(std::malloc(size + 2));
+  if (!text) return false;
+  std::memcpy(text, from, size);
+  text[size] = text[size + 1] = '\0';
+  length = size;
+  reserved = size + 2;
+  return true;
+}
+
+void Source::close() {
+  if (mapped) {
+    munmap(text, reserved);
+  }
+  else {
+    std::free(text);
+  }
+  text = nullptr;
+  length = reserved = 0;
+  mapped = false;
+}
+
+bool Source::mapFile(int fd, unsigned long bytes) {
+  const unsigned long page = sysconf(_SC_PAGESIZE);
+  const unsigned long total = (bytes + 2 + page - 1) / page * page;
+  // zeroed pages for the whole, then the file over the start of them:
+  // whatever follows the end of the file reads as NUL, even when the
+  // file ends on a page boundary
+  void* base = mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (base == MAP_FAILED) return false;
+  if (bytes && mmap(base, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED) {
+    munmap(base, total);
+    return false;
+  }
+  madvise(base, total, MADV_SEQUENTIAL);
+  text = static_cast<char*>(base);
+  length = bytes;
+  reserved = total;
+  mapped = true;
+  return true;
+}
+
+bool Source::readFile(FILE* file) {
+  reserved = 64 * 1024;
+  text = static_cast<char*>(std::malloc(reserved));
+  while (text) {
+    length += std::fread(text + length, 1, reserved - length - 2, file);
+    if (length + 2 < reserved) break;
+    reserved *= 2;
+    char* grown = static_cast<char*>(std::realloc(text, reserved));
+    if (!grown) std::free(text);
+    text = grown;
+  }
+  if (!text || std::ferror(file)) {
+    close();
+    return false;
+  }
+  text[length] = text[length + 1] = '\0';
+  return true;
+}
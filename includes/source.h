@@ -0,0 +1,47 @@
+#pragma once
+
+//  The text of a script, whole in memory, for the scanner to work on in
+//  place (see yy_scan_buffer) instead of copying it through flex's read
+//  buffers. A regular file is mapped; anything else, like a pipe, is
+//  read in. Either way the text is followed by the two NULs flex wants
+//  at the end of a buffer, and it is writable, since flex puts a NUL
+//  after each token while its action runs.
+//
+//  Tokens whose text the parser needs point into it, so it has to stay
+//  open until parsing is done.
+
+#include <cstdio>
+
+// the text of a token, in the buffer being scanned; not NUL-terminated
+struct TokenView {
+  const char* text;
+  unsigned long length;
+};
+
+class Source {
+public:
+  Source() : text(nullptr), length(0), reserved(0), mapped(false) {}
+  ~Source() { close(); }
+
+  // the whole of file, mapped if it is regular and map is set; false,
+  // with errno set, if it cannot be read
+  bool open(FILE* file, bool map = true);
+  // a copy of size bytes of text, for a script given as a string
+  bool open(const char* text, unsigned long size);
+  void close();
+
+  char* data() const { return text; }
+  unsigned long size() const { return length; }
+  bool isMapped() const { return mapped; }
+
+  Source(const Source&) = delete;
+  Source& operator=(const Source&) = delete;
+private:
+  bool mapFile(int fd, unsigned long bytes);
+  bool readFile(FILE* file);
+
+  char* text;
+  unsigned long length;
+  unsigned long reserved;  // bytes mapped or allocated, the NULs included
+  bool mapped;
+};
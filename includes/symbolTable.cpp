@@ -1,75 +1,104 @@
-#include <map>
 #include <algorithm>
 #include "symbolTable.h"
-#include "literal.h"
+#include "gc.h"
 
-const Literal* SymbolTable::getValue(const std::string& name) const {
-  std::map<std::string, const Literal*>::const_iterator it = symbols.find(name);
-  if (it == symbols.end()) {
-    return nullptr;
+const SymbolTable::Entry* SymbolTable::lookup(const Atom* name) const {
+  if (entries.empty()) return nullptr;
+  const unsigned long mask = entries.size() - 1;
+  unsigned long i = name->hash() & mask;
+  while (entries[i].name) {
+    if (entries[i].name == name) return &entries[i];
+    i = (i + 1) & mask;
   }
-  return it->second;
+  return nullptr;
 }
 
-void SymbolTable::setValue(const std::string& name, const Literal* val) {
-  symbols[name] = val;
+SymbolTable::Entry& SymbolTable::insert(const Atom* name) {
+  if ((used + 1) * 2 > entries.size()) grow();
+  const unsigned long mask = entries.size() - 1;
+  unsigned long i = name->hash() & mask;
+  while (entries[i].name && entries[i].name != name) {
+    i = (i + 1) & mask;
+  }
+  if (!entries[i].name) {
+    entries[i].name = name;
+    ++used;
+  }
+  return entries[i];
 }
 
-const Node* SymbolTable::getFunc(const std::string& name) const {
-  std::map<std::string, const Node*>::const_iterator it = functions.find(name);
-  if (it == functions.end()) {
-    return nullptr;
+void SymbolTable::grow() {
+  std::vector<Entry> old(entries.empty() ? 8 : entries.size() * 2,
+                         Entry{nullptr, nullptr, Value::undefined()});
+  old.swap(entries);
+  const unsigned long mask = entries.size() - 1;
+  for (const Entry& entry : old) {
+    if (!entry.name) continue;
+    unsigned long i = entry.name->hash() & mask;
+    while (entries[i].name) i = (i + 1) & mask;
+    entries[i] = entry;
   }
-  return it->second;
 }
 
-void SymbolTable::setFunc(const std::string& name, const Node* node) {
-  functions[name] = node;
+void SymbolTable::clear() {
+  funcs = false;
+  if (used == 0) return;
+  std::fill(entries.begin(), entries.end(), Entry{nullptr, nullptr, Value::undefined()});
+  used = 0;
 }
 
-Node* SymbolTable::getParams(const std::string& name) const {
-  std::map<std::string, Node*>::const_iterator it = params.find(name);
-  if (it == params.end()) {
-    return nullptr;
-  }
-  return it->second;
+Value SymbolTable::getValue(const Atom* name) const {
+  const Entry* entry = lookup(name);
+  return entry ? entry->value : Value::undefined();
 }
 
-void SymbolTable::setParams(const std::string& name, Node* node) {
-  params[name] = node;
+void SymbolTable::setValue(const Atom* name, const Value& val) {
+  insert(name).value = val;
 }
 
-bool SymbolTable::findValue(const std::string& name) const {
-  return symbols.find(name) != symbols.end();
+const FuncNode* SymbolTable::getFunc(const Atom* name) const {
+  const Entry* entry = lookup(name);
+  return entry ? entry->func : nullptr;
 }
 
-bool SymbolTable::findFunc(const std::string& name) const {
-  return functions.find(name) != functions.end();
+void SymbolTable::setFunc(const Atom* name, const FuncNode* node) {
+  insert(name).func = node;
+  funcs = true;
 }
 
-bool SymbolTable::findParams(const std::string& name) const {
-  return params.find(name) != params.end();
+bool SymbolTable::findValue(const Atom* name) const {
+  const Entry* entry = lookup(name);
+  return entry && !entry->value.isUndefined();
+}
+
+bool SymbolTable::findFunc(const Atom* name) const {
+  const Entry* entry = lookup(name);
+  return entry && entry->func;
+}
+
+void SymbolTable::markValues(Heap& heap) const {
+  for (const Entry& entry : entries) {
+    heap.mark(entry.value);
+  }
+  for (unsigned long i = 0; i < size; ++i) {
+    heap.mark(slots[i]);
+  }
 }
 
 void SymbolTable::print() const {
   std::cout << "symbols: " << std::endl;
-  std::map<std::string, const Literal*>::const_iterator it = symbols.cbegin();
-  while (it != symbols.cend()) {
-    std::cout << it->first << std::endl;
-    it->second->eval()->print();
-    ++it;
+  for (const Entry& entry : entries) {
+    if (!entry.name || entry.value.isUndefined()) continue;
+    std::cout << entry.name->str() << std::endl;
+    entry.value.print();
   }
-  std::cout << "functions: ";
-  std::map<std::string, const Node*>::const_iterator itr = functions.cbegin();
-  while (itr != functions.cend()) {
-    std::cout << itr->first << " ";
-    ++itr;
+  std::cout << "slots: " << std::endl;
+  for (unsigned long i = 0; i < size; ++i) {
+    if (!slots[i].isUndefined()) slots[i].print();
   }
-  std::cout << std::endl << "params for : ";
-  std::map<std::string, Node*>::const_iterator pit = params.cbegin();
-  while (pit != params.cend()) {
-    std::cout << pit->first << " ";
-    ++pit;
+  std::cout << "functions: ";
+  for (const Entry& entry : entries) {
+    if (entry.name && entry.func) std::cout << entry.name->str() << " ";
   }
   std::cout << std::endl << std::endl;
 }
@@ -3,37 +3,71 @@
 
 #include <iostream>
 #include <string>
-#include <map>
-#include <algorithm>
+#include <vector>
+#include "value.h"
+#include "interner.h"
 
-class Node;
-class Literal;
+class FuncNode;
+class Heap;
 
+// One activation: the slots the resolver assigned to its variables,
+// the names bound in it, and the scope its function was defined in
+// (the static link followed to reach enclosing variables).
+//
+// Names are atoms, and a name's function and value share one entry
+// of an open-addressing table, so a lookup is a pointer compare on
+// the first probe in the common case.
 class SymbolTable {
 public:
-  SymbolTable(): functions(), symbols() {}
+  struct Entry {
+    const Atom* name;
+    const FuncNode* func;
+    Value value;  // undefined if only a function is bound
+  };
+
+  SymbolTable() : entries(), used(0), slots(nullptr), size(0), parent(nullptr), funcs(false) {}
   ~SymbolTable() {}
 
-  const Node* getFunc(const std::string& name) const;
-  const Literal* getValue(const std::string& name) const;
-  Node* getParams(const std::string& name) const;
+  // forget every name, so the table can serve another activation
+  void clear();
+  // the slots live outside the table, see TableManager
+  void bind(SymbolTable* p, Value* s, unsigned long n) { parent = p; slots = s; size = n; }
+
+  // nullptr if name is not bound here
+  const Entry* lookup(const Atom* name) const;
+
+  const FuncNode* getFunc(const Atom* name) const;
+  Value getValue(const Atom* name) const;
 
-  void setFunc(const std::string& name, const Node* node);
-  void setValue(const std::string& name, const Literal* val);
-  void setParams(const std::string& name, Node* node);
+  void setFunc(const Atom* name, const FuncNode* node);
+  void setValue(const Atom* name, const Value& val);
 
-  bool findFunc(const std::string&) const;
-  bool findValue(const std::string&) const;
-  bool findParams(const std::string&) const;
+  bool findFunc(const Atom*) const;
+  bool findValue(const Atom*) const;
+  // whether a def has run in this scope
+  bool bindsFunctions() const { return funcs; }
+
+  const Value& getSlot(int slot) const { return slots[slot]; }
+  void setSlot(int slot, const Value& val) { slots[slot] = val; }
+  Value* getSlots() const { return slots; }
+  SymbolTable* getParent() const { return parent; }
 
   void print() const;
+  void markValues(Heap&) const;
   SymbolTable(const SymbolTable&) = delete;
   SymbolTable& operator=(const SymbolTable&) = delete;
 
 private:
-  std::map<std::string, const Node*> functions;
-  std::map<std::string, Node*> params;
-  std::map<std::string, const Literal*> symbols;
+  Entry& insert(const Atom* name);
+  void grow();
+
+  // empty until the first binding, then a power of two in size
+  std::vector<Entry> entries;
+  unsigned long used;
+  Value* slots;
+  unsigned long size;
+  SymbolTable* parent;
+  bool funcs;
 };
 
 #endif
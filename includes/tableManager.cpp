@@ -1,7 +1,27 @@
+#include <algorithm>
+#include <pthread.h>
 #include "tableManager.h"
 
+namespace {
+
+// what a call needs below the floor: the deepest expression of one
+// Python call, then raising the error
+const unsigned long stackReserve = 256 * 1024;
+
+}
+
+const char* TableManager::nativeStackFloor() {
+    pthread_attr_t attr;
+    if (pthread_getattr_np(pthread_self(), &attr) != 0) return nullptr;
+    void* low = nullptr;
+    size_t size = 0;
+    const bool known = pthread_attr_getstack(&attr, &low, &size) == 0 && size > 2 * stackReserve;
+    pthread_attr_destroy(&attr);
+    return known ? static_cast<const char*>(low) + stackReserve : nullptr;
+}
+
 TableManager& TableManager::getInstance() {
-    static TableManager instance;
+    static thread_local TableManager instance;
     return instance;
 }
 
@@ -11,97 +31,122 @@ TableManager::~TableManager() {
     }
 }
 
-void TableManager::pushScope() {
-    if (tables.size() >= stackLimit) {
+void TableManager::pushScope(SymbolTable* parent, unsigned long frameSize) {
+    if (static_cast<unsigned long>(currentScope) + 1 >= stackLimit ||
+        static_cast<const char*>(__builtin_frame_address(0)) < stackFloor) {
         throw std::string("RuntimeError: maximum recursion depth exceeded");
     }
-    SymbolTable* table = new SymbolTable();
-    tables.push_back(table);
+    const Arena::Mark mark = frameSlots.mark();
+    Value* slots = frameSlots.makeArray<Value>(frameSize);
+    std::fill(slots, slots + frameSize, Value::undefined());
+
     ++currentScope;
+    if (static_cast<unsigned long>(currentScope) == tables.size()) {
+        tables.push_back(new SymbolTable());
+        marks.push_back(mark);
+        ++framesAllocated;
+    } else {
+        tables[currentScope]->clear();
+        marks[currentScope] = mark;
+        ++framesReused;
+    }
+    if (currentScope > deepest) deepest = currentScope;
+    current = tables[currentScope];
+    current->bind(parent, slots, frameSize);
 }
 
 void TableManager::popScope() {
     if (currentScope == 0) return;
-    tables.pop_back();
+    if (current->bindsFunctions()) {
+        --funcFrames;
+        ++funcVersion;
+    }
+    frameSlots.release(marks[currentScope]);
     --currentScope;
+    current = tables[currentScope];
 }
 
 int TableManager::getCurrentScope() const {
     return currentScope;
 }
 
-const Node* TableManager::getFunc(const std::string& name) {
-    std::vector<SymbolTable*>::reverse_iterator rit = tables.rbegin();
+const FuncNode* TableManager::getFunc(const Atom* name, SymbolTable** scope) {
+    std::vector<SymbolTable*>::reverse_iterator rit = tables.rbegin() + (tables.size() - 1 - currentScope);
     while (rit != tables.rend()) {
-        if ((*rit)->findFunc(name))
-            return (*rit)->getFunc(name);
+        const SymbolTable::Entry* entry = (*rit)->lookup(name);
+        if (entry && entry->func) {
+            if (scope) *scope = *rit;
+            return entry->func;
+        }
         ++rit;
     }
-    throw std::string("NameError: function ") + name + std::string(" is not defined");
+    throw std::string("NameError: function ") + name->str() + std::string(" is not defined");
     return nullptr;
 }
 
-const Literal* TableManager::getValue(const std::string& name) {
-    std::vector<SymbolTable*>::reverse_iterator rit = tables.rbegin();
+Value TableManager::getValue(const Atom* name) {
+    std::vector<SymbolTable*>::reverse_iterator rit = tables.rbegin() + (tables.size() - 1 - currentScope);
     while (rit != tables.rend()) {
-        if ((*rit)->findValue(name))
-            return (*rit)->getValue(name);
+        const SymbolTable::Entry* entry = (*rit)->lookup(name);
+        if (entry && !entry->value.isUndefined())
+            return entry->value;
         ++rit;
     }
-    throw std::string("NameError: symbol ") + name + std::string(" is not defined");
-    return nullptr;
+    throw std::string("NameError: symbol ") + name->str() + std::string(" is not defined");
+    return Value();
 }
 
-Node* TableManager::getParams(const std::string& name) {
-    std::vector<SymbolTable*>::reverse_iterator rit = tables.rbegin();
-    while (rit != tables.rend()) {
-        if ((*rit)->findParams(name))
-            return (*rit)->getParams(name);
-        ++rit;
+const Value& TableManager::getEnclosing(int depth, int slot) const {
+    const SymbolTable* table = current;
+    while (depth--) {
+        table = table->getParent();
     }
-    throw std::string("NameError: params for ") + name + std::string(" is not defined");
-    return nullptr;
-}
-
-void TableManager::setFunc(const std::string& name, const Node* node) {
-    tables[currentScope]->setFunc(name, node);
+    return table->getSlot(slot);
 }
 
-void TableManager::setValue(const std::string& name, const Literal* val) {
-    tables[currentScope]->setValue(name, val);
+void TableManager::setFunc(const Atom* name, const FuncNode* node) {
+    if (currentScope > 0 && !current->bindsFunctions()) ++funcFrames;
+    current->setFunc(name, node);
+    ++funcVersion;
 }
 
-void TableManager::setParams(const std::string& name, Node* node) {
-    tables[currentScope]->setParams(name, node);
+void TableManager::setValue(const Atom* name, const Value& val) {
+    current->setValue(name, val);
 }
 
-bool TableManager::findValue(const std::string& name) const {
+bool TableManager::findValue(const Atom* name) const {
     return tables[currentScope]->findValue(name);
 }
 
-bool TableManager::findFunc(const std::string& name) const {
+bool TableManager::findFunc(const Atom* name) const {
     return tables[currentScope]->findFunc(name);
 }
 
-bool TableManager::findParams(const std::string& name) const {
-    return tables[currentScope]->findParams(name);
+// resizing only happens between top-level statements, while no frame
+// other than the module's is active
+void TableManager::reserveGlobals(unsigned long n) {
+    globals.resize(n, Value::undefined());
+    tables[0]->bind(nullptr, globals.data(), globals.size());
 }
 
-bool TableManager::needReturnValue() const {
-    return tables[currentScope]->findValue("__RETURN__");
+void TableManager::markRoots(Heap& heap) const {
+    for (int i = 0; i <= currentScope; ++i) {
+        tables[i]->markValues(heap);
+    }
 }
 
-const Literal* TableManager::getReturnValue() {
-    return tables[currentScope]->getValue("__RETURN__");
+void TableManager::printFrameStats(std::ostream& out) const {
+    out << "frames: " << framesAllocated << " allocated, " << framesReused
+        << " reused, deepest " << deepest << " (limit " << stackLimit << ")" << std::endl;
 }
 
-void TableManager::setReturnValue(const Literal* val) {
-    tables[currentScope]->setValue("__RETURN__", val);
+void TableManager::printCacheStats(std::ostream& out) const {
+    out << "call cache: " << cacheHits << " hits, " << cacheMisses << " misses" << std::endl;
 }
 
 void TableManager::print() const {
     std::cout << "current scope: " << currentScope << std::endl;
-    for (int i = tables.size() - 1; i >= 0; --i) {
+    for (int i = currentScope; i >= 0; --i) {
         std::cout << "scope " << i << std::endl;
         tables[i]->print();
     }
@@ -1,48 +1,146 @@
+#pragma once
+
 #include <string>
 #include <vector>
+#include "arena.h"
 #include "symbolTable.h"
 
+// What a call site remembers of the function its name last resolved
+// to. It is valid while no def has run or been unwound since (the
+// version) and the lookup would start from the same frame. A function
+// found among the globals is also valid from any other frame as long
+// as no active frame binds functions of its own.
+struct FuncCache {
+    unsigned long version;
+    const SymbolTable* from;
+    const FuncNode* func;
+    SymbolTable* scope;
+};
+
+class TableManager;
+
+// Pops, when it goes, every frame pushed since it was made: at the end
+// of a call, or as an error unwinds through it.
+class ScopeGuard {
+public:
+    explicit ScopeGuard(TableManager& t);
+    ~ScopeGuard();
+    ScopeGuard(const ScopeGuard&) = delete;
+    ScopeGuard& operator=(const ScopeGuard&) = delete;
+private:
+    TableManager& tm;
+    int scope;
+};
+
 class TableManager {
 public:
     static TableManager& getInstance();
     ~TableManager();
 
-    void pushScope();
+    // a frame of frameSize slots whose enclosing scope is parent
+    void pushScope(SymbolTable* parent, unsigned long frameSize);
     void popScope();
+    // pops frames until scope is the current one
+    void unwindTo(int scope) {
+        while (currentScope > scope) popScope();
+    }
     int getCurrentScope() const;
 
-    const Node* getFunc(const std::string&);
-    const Literal* getValue(const std::string&);
-    Node* getParams(const std::string& name);
-    void setFunc(const std::string&, const Node*);
-    void setValue(const std::string&, const Literal*);
-    void setParams(const std::string& name, Node*);
+    // the innermost visible function called name, and optionally the
+    // scope it was defined in
+    const FuncNode* getFunc(const Atom*, SymbolTable** scope = nullptr);
+    // the same, answered from the call site's cache when it is still valid
+    const FuncNode* getFunc(const Atom* name, SymbolTable** scope, FuncCache& cache) {
+        if (cache.version == funcVersion &&
+            (cache.from == current || (cache.scope == tables[0] && funcFrames == 0))) {
+            ++cacheHits;
+            *scope = cache.scope;
+            return cache.func;
+        }
+        ++cacheMisses;
+        const FuncNode* func = getFunc(name, scope);
+        cache = FuncCache{funcVersion, current, func, *scope};
+        return func;
+    }
+    Value getValue(const Atom*);
+    // a function bound among the globals, nullptr if there is none
+    const FuncNode* getGlobalFunc(const Atom* name) const { return tables[0]->getFunc(name); }
+    // true while every function name resolves among the globals, from any
+    // frame, to the same functions as long as the version stays the same
+    bool functionsAreGlobal() const { return funcFrames == 0; }
+    unsigned long getFuncVersion() const { return funcVersion; }
+    void setFunc(const Atom*, const FuncNode*);
+    void setValue(const Atom*, const Value&);
     void print() const;
 
-    bool findValue(const std::string&) const;
-    bool findFunc(const std::string&) const ;
-    bool findParams(const std::string&) const;
+    // variables, by the location the Resolver gave them
+    SymbolTable* currentTable() const { return current; }
+    const Value& getLocal(int slot) const { return current->getSlot(slot); }
+    void setLocal(int slot, const Value& val) { current->setSlot(slot, val); }
+    const Value& getEnclosing(int depth, int slot) const;
+    const Value& getGlobal(int slot) const { return globals[slot]; }
+    void setGlobal(int slot, const Value& val) { globals[slot] = val; }
+    Value* getGlobals() { return globals.data(); }
+    void reserveGlobals(unsigned long n);
+    // every value bound in a live scope
+    void markRoots(Heap&) const;
+
+    bool findValue(const Atom*) const;
+    bool findFunc(const Atom*) const ;
 
-    bool needReturnValue() const;
-    const Literal* getReturnValue();
-    void setReturnValue(const Literal*);
+    void setRecursionLimit(unsigned long limit) { stackLimit = limit; }
+    const Arena& getFrameArena() const { return frameSlots; }
+    void printFrameStats(std::ostream&) const;
+    void printCacheStats(std::ostream&) const;
 
     TableManager(const TableManager&) = delete;
     TableManager& operator=(const TableManager&) = delete;
 
 private:
-    TableManager(): tables(), stackLimit(1000), currentScope(0) {
+    // globals, builtins included, are bound by the Resolver
+    TableManager(): tables(), marks(), globals(), frameSlots("frames"),
+        stackLimit(1000), stackFloor(nativeStackFloor()), currentScope(0), current(nullptr),
+        framesAllocated(1), framesReused(0), deepest(0),
+        funcVersion(1), funcFrames(0), cacheHits(0), cacheMisses(0) {
         tables.push_back(new SymbolTable());
+        marks.push_back(frameSlots.mark());
+        current = tables[0];
     }
 
-    // for stack, the top is current scope
-    // std::stack<SymbolTable*> tableStack;
+    // tables[0..currentScope] are the active frames, the top is the
+    // current scope; tables above it are kept to be reused by later calls
     std::vector<SymbolTable*> tables;
+    // where each frame's slots start in frameSlots
+    std::vector<Arena::Mark> marks;
+    std::vector<Value> globals;
+    // the slots of every active frame, one contiguous block per frame,
+    // handed back as frames are popped
+    Arena frameSlots;
 
     // the maximum depth of the Python interpreter stack,
     // prevents infinite recursion from causing an overflow of the C stack
     // according to some sources, the default recursion limit is set to 1000
     // https://stackoverflow.com/a/3323013
-    const unsigned long stackLimit;
+    unsigned long stackLimit;
+    // the AST engine recurses natively, a call at least once per Python
+    // call, so whatever the limit, a call is refused once this thread's
+    // stack has grown down to here; null if the stack is not known
+    static const char* nativeStackFloor();
+    const char* stackFloor;
     int currentScope;
-};
\ No newline at end of file
+    SymbolTable* current;
+
+    unsigned long framesAllocated;
+    unsigned long framesReused;
+    int deepest;
+
+    // bumped whenever a function binding is made or goes away
+    unsigned long funcVersion;
+    // active frames, the globals aside, that bind functions
+    unsigned long funcFrames;
+    unsigned long cacheHits;
+    unsigned long cacheMisses;
+};
+
+inline ScopeGuard::ScopeGuard(TableManager& t) : tm(t), scope(t.getCurrentScope()) {}
+inline ScopeGuard::~ScopeGuard() { tm.unwindTo(scope); }
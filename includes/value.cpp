@@ -0,0 +1,498 @@
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include "value.h"
+#include "bigint.h"
+#include "gc.h"
+#include "interpreter.h"
+
+namespace {
+
+typedef Value (*BinaryFn)(const Value&, const Value&);
+
+const char* const opSymbol[Value::NUM_OPS] = {
+  "+", "-", "*", "/", "//", "%", "**", "<", ">", "==", ">=", "<="
+};
+
+template <int OP>
+Value typeError(const Value& x, const Value& y) {
+  throw std::string("TypeError: unsupported operand type(s) for ") + opSymbol[OP]
+      + std::string(": '") + x.typeName() + std::string("' and '") + y.typeName() + std::string("'");
+}
+
+const std::string intZeroDivision("ZeroDivisionError: integer division or modulo by zero");
+const std::string zeroNegativePower("ZeroDivisionError: 0.0 cannot be raised to a negative power");
+
+// floor division and modulo follow Python: the remainder takes the sign of the divisor
+long floorDiv(long x, long y) {
+  long q = x / y;
+  if ((x % y != 0) && ((x < 0) != (y < 0))) --q;
+  return q;
+}
+
+long floorMod(long x, long y) {
+  long r = x % y;
+  if (r != 0 && ((r < 0) != (y < 0))) r += y;
+  return r;
+}
+
+// long op long, or long mixed with int. These are also the slow
+// paths of the int kernels, kept out of line so that the int kernels
+// need no stack frame.
+
+__attribute__((noinline))
+Value longAdd(const Value& x, const Value& y) { return Value::integer(x.toBigInt() + y.toBigInt()); }
+__attribute__((noinline))
+Value longSub(const Value& x, const Value& y) { return Value::integer(x.toBigInt() - y.toBigInt()); }
+__attribute__((noinline))
+Value longMul(const Value& x, const Value& y) { return Value::integer(x.toBigInt() * y.toBigInt()); }
+
+Value longDiv(const Value& x, const Value& y) {
+  BigInt q, r;
+  BigInt::divMod(x.toBigInt(), y.toBigInt(), q, r);
+  return Value::integer(q);
+}
+
+Value longMod(const Value& x, const Value& y) {
+  BigInt q, r;
+  BigInt::divMod(x.toBigInt(), y.toBigInt(), q, r);
+  return Value::integer(r);
+}
+
+__attribute__((noinline))
+Value longPow(const Value& x, const Value& y) {
+  const BigInt exp = y.toBigInt();
+  if (exp.isNegative()) {
+    if (x.toBigInt().isZero()) throw zeroNegativePower;
+    return Value(std::pow(x.getFloat(), y.getFloat()));
+  }
+  if (!exp.fitsLong()) throw std::string("OverflowError: exponent too large");
+  return Value::integer(x.toBigInt().pow(exp.toLong()));
+}
+
+Value longLess(const Value& x, const Value& y) { return Value::boolean(BigInt::compare(x.toBigInt(), y.toBigInt()) < 0); }
+Value longGreater(const Value& x, const Value& y) { return Value::boolean(BigInt::compare(x.toBigInt(), y.toBigInt()) > 0); }
+Value longEqual(const Value& x, const Value& y) { return Value::boolean(BigInt::compare(x.toBigInt(), y.toBigInt()) == 0); }
+Value longGrtEq(const Value& x, const Value& y) { return Value::boolean(BigInt::compare(x.toBigInt(), y.toBigInt()) >= 0); }
+Value longLessEq(const Value& x, const Value& y) { return Value::boolean(BigInt::compare(x.toBigInt(), y.toBigInt()) <= 0); }
+
+// int op int (bools take part as 0 and 1). A result that does not
+// fit in a machine word is computed again as a long.
+
+Value intAdd(const Value& x, const Value& y) {
+  long res;
+  if (__builtin_add_overflow(x.getInt(), y.getInt(), &res)) {
+    return longAdd(x, y);
+  }
+  return Value(res);
+}
+
+Value intSub(const Value& x, const Value& y) {
+  long res;
+  if (__builtin_sub_overflow(x.getInt(), y.getInt(), &res)) {
+    return longSub(x, y);
+  }
+  return Value(res);
+}
+
+Value intMul(const Value& x, const Value& y) {
+  long res;
+  if (__builtin_mul_overflow(x.getInt(), y.getInt(), &res)) {
+    return longMul(x, y);
+  }
+  return Value(res);
+}
+
+Value intDiv(const Value& x, const Value& y) {
+  if (y.getInt() == 0) throw intZeroDivision;
+  if (y.getInt() == -1) return intSub(Value(0L), x);
+  return Value(floorDiv(x.getInt(), y.getInt()));
+}
+
+Value intMod(const Value& x, const Value& y) {
+  if (y.getInt() == 0) throw intZeroDivision;
+  if (y.getInt() == -1) return Value(0L);
+  return Value(floorMod(x.getInt(), y.getInt()));
+}
+
+Value intPow(const Value& x, const Value& y) {
+  long base = x.getInt(), exp = y.getInt();
+  if (exp < 0) {
+    if (base == 0) throw zeroNegativePower;
+    return Value(std::pow(static_cast<double>(base), static_cast<double>(exp)));
+  }
+  // exponentiation by squaring, finished as a long on overflow
+  long res = 1;
+  while (exp) {
+    if ((exp & 1) && __builtin_mul_overflow(res, base, &res)) break;
+    exp >>= 1;
+    if (exp && __builtin_mul_overflow(base, base, &base)) break;
+  }
+  if (!exp) return Value(res);
+  return longPow(x, y);
+}
+
+Value intLess(const Value& x, const Value& y) { return Value::boolean(x.getInt() < y.getInt()); }
+Value intGreater(const Value& x, const Value& y) { return Value::boolean(x.getInt() > y.getInt()); }
+Value intEqual(const Value& x, const Value& y) { return Value::boolean(x.getInt() == y.getInt()); }
+Value intGrtEq(const Value& x, const Value& y) { return Value::boolean(x.getInt() >= y.getInt()); }
+Value intLessEq(const Value& x, const Value& y) { return Value::boolean(x.getInt() <= y.getInt()); }
+
+// float op float, or float mixed with int
+
+Value floatAdd(const Value& x, const Value& y) { return Value(x.getFloat() + y.getFloat()); }
+Value floatSub(const Value& x, const Value& y) { return Value(x.getFloat() - y.getFloat()); }
+Value floatMul(const Value& x, const Value& y) { return Value(x.getFloat() * y.getFloat()); }
+
+Value floatDiv(const Value& x, const Value& y) {
+  if (y.getFloat() == 0) throw std::string("ZeroDivisionError: float division by zero");
+  return Value(x.getFloat() / y.getFloat());
+}
+
+Value floatIntDiv(const Value& x, const Value& y) {
+  if (y.getFloat() == 0) throw std::string("ZeroDivisionError: float divmod()");
+  return Value(std::floor(x.getFloat() / y.getFloat()));
+}
+
+Value floatMod(const Value& x, const Value& y) {
+  double lhs = x.getFloat(), rhs = y.getFloat();
+  if (rhs == 0) throw std::string("ZeroDivisionError: float modulo");
+  double r = std::fmod(lhs, rhs);
+  if (r != 0 && ((r < 0) != (rhs < 0))) r += rhs;
+  return Value(r);
+}
+
+Value floatPow(const Value& x, const Value& y) {
+  double base = x.getFloat(), exp = y.getFloat();
+  if (base == 0 && exp < 0) throw zeroNegativePower;
+  if (base < 0 && exp != std::floor(exp)) {
+    throw std::string("ValueError: negative number cannot be raised to a fractional power");
+  }
+  return Value(std::pow(base, exp));
+}
+
+Value floatLess(const Value& x, const Value& y) { return Value::boolean(x.getFloat() < y.getFloat()); }
+Value floatGreater(const Value& x, const Value& y) { return Value::boolean(x.getFloat() > y.getFloat()); }
+Value floatEqual(const Value& x, const Value& y) { return Value::boolean(x.getFloat() == y.getFloat()); }
+Value floatGrtEq(const Value& x, const Value& y) { return Value::boolean(x.getFloat() >= y.getFloat()); }
+Value floatLessEq(const Value& x, const Value& y) { return Value::boolean(x.getFloat() <= y.getFloat()); }
+
+// int or long mixed with float. The arithmetic is done in floats, but
+// a comparison is exact: the integer against the float's integer part,
+// then against its fraction, with no rounding of the integer to a float.
+// Ints of up to 53 bits convert exactly, and are compared as floats.
+
+bool exactAsFloat(const Value& v) {
+  if (v.getType() == Value::FLOAT) return true;
+  const long limit = 1L << 53;
+  return v.getType() != Value::LONG && v.getInt() <= limit && v.getInt() >= -limit;
+}
+
+// -1, 0 or 1, or 2 if the float is a NaN, which is unordered
+int compareIntFloat(const Value& x, const Value& y) {
+  if (x.getType() == Value::FLOAT) {
+    const int cmp = compareIntFloat(y, x);
+    return cmp == 2 ? cmp : -cmp;
+  }
+  const double f = y.getFloat();
+  if (std::isnan(f)) return 2;
+  if (std::isinf(f)) return f > 0 ? -1 : 1;
+  const double whole = std::trunc(f);
+  const int cmp = BigInt::compare(x.toBigInt(), BigInt::fromDouble(whole));
+  if (cmp) return cmp;
+  return f > whole ? -1 : f < whole ? 1 : 0;
+}
+
+Value intFloatLess(const Value& x, const Value& y) {
+  if (exactAsFloat(x) && exactAsFloat(y)) return floatLess(x, y);
+  return Value::boolean(compareIntFloat(x, y) == -1);
+}
+
+Value intFloatGreater(const Value& x, const Value& y) {
+  if (exactAsFloat(x) && exactAsFloat(y)) return floatGreater(x, y);
+  return Value::boolean(compareIntFloat(x, y) == 1);
+}
+
+Value intFloatEqual(const Value& x, const Value& y) {
+  if (exactAsFloat(x) && exactAsFloat(y)) return floatEqual(x, y);
+  return Value::boolean(compareIntFloat(x, y) == 0);
+}
+
+Value intFloatGrtEq(const Value& x, const Value& y) {
+  if (exactAsFloat(x) && exactAsFloat(y)) return floatGrtEq(x, y);
+  const int cmp = compareIntFloat(x, y);
+  return Value::boolean(cmp == 0 || cmp == 1);
+}
+
+Value intFloatLessEq(const Value& x, const Value& y) {
+  if (exactAsFloat(x) && exactAsFloat(y)) return floatLessEq(x, y);
+  return Value::boolean(compareIntFloat(x, y) <= 0);
+}
+
+// str op str, or anything mixed with None or a str
+
+Value strAdd(const Value& x, const Value& y) {
+  if (x.getType() != Value::STR || y.getType() != Value::STR) {
+    if (x.getType() == Value::STR) {
+      throw std::string("TypeError: cannot concatenate 'str' and '") + y.typeName() + std::string("' objects");
+    }
+    return typeError<Value::ADD>(x, y);
+  }
+  const StrObject* lhs = x.getStr();
+  const StrObject* rhs = y.getStr();
+  StrObject* res = Heap::getInstance().newString(nullptr, lhs->length() + rhs->length());
+  std::memcpy(res->data(), lhs->chars(), lhs->length());
+  std::memcpy(res->data() + lhs->length(), rhs->chars(), rhs->length());
+  return Value::string(res);
+}
+
+Value strMul(const Value& x, const Value& y) {
+  // a number with None, or None with None: there is no sequence
+  if (x.getType() != Value::STR && y.getType() != Value::STR) return typeError<Value::MUL>(x, y);
+  const Value& seq = x.getType() == Value::STR ? x : y;
+  const Value& count = x.getType() == Value::STR ? y : x;
+  if (count.getType() != Value::INT && count.getType() != Value::BOOL && count.getType() != Value::LONG) {
+    throw std::string("TypeError: can't multiply sequence by non-int of type '") + count.typeName() + std::string("'");
+  }
+  // Python raises this for a negative long as well
+  if (count.getType() == Value::LONG) {
+    throw std::string("OverflowError: cannot fit 'long' into an index-sized integer");
+  }
+  const StrObject* str = seq.getStr();
+  long n = count.getInt() > 0 ? count.getInt() : 0;
+  if (str->length() && static_cast<unsigned long>(n) > LONG_MAX / str->length()) {
+    throw std::string("OverflowError: repeated string is too long");
+  }
+  StrObject* res = Heap::getInstance().newString(nullptr, n * str->length());
+  for (long k = 0; k < n; ++k) {
+    std::memcpy(res->data() + k * str->length(), str->chars(), str->length());
+  }
+  return Value::string(res);
+}
+
+// Python 2 orders None before every number, and numbers before strings
+int typeRank(const Value& v) {
+  switch (v.getType()) {
+    case Value::NONE: return 0;
+    case Value::STR: return 2;
+    default: return 1;
+  }
+}
+
+int compareMixed(const Value& x, const Value& y) {
+  int rx = typeRank(x), ry = typeRank(y);
+  if (rx != ry) return rx < ry ? -1 : 1;
+  if (rx != 2) return 0;
+  const StrObject* lhs = x.getStr();
+  const StrObject* rhs = y.getStr();
+  unsigned long n = lhs->length() < rhs->length() ? lhs->length() : rhs->length();
+  int cmp = std::memcmp(lhs->chars(), rhs->chars(), n);
+  if (cmp) return cmp < 0 ? -1 : 1;
+  if (lhs->length() == rhs->length()) return 0;
+  return lhs->length() < rhs->length() ? -1 : 1;
+}
+
+Value mixedLess(const Value& x, const Value& y) { return Value::boolean(compareMixed(x, y) < 0); }
+Value mixedGreater(const Value& x, const Value& y) { return Value::boolean(compareMixed(x, y) > 0); }
+Value mixedEqual(const Value& x, const Value& y) { return Value::boolean(compareMixed(x, y) == 0); }
+Value mixedGrtEq(const Value& x, const Value& y) { return Value::boolean(compareMixed(x, y) >= 0); }
+Value mixedLessEq(const Value& x, const Value& y) { return Value::boolean(compareMixed(x, y) <= 0); }
+
+const BinaryFn intKernels[Value::NUM_OPS] = {
+  intAdd, intSub, intMul, intDiv, intDiv, intMod, intPow,
+  intLess, intGreater, intEqual, intGrtEq, intLessEq
+};
+
+const BinaryFn floatKernels[Value::NUM_OPS] = {
+  floatAdd, floatSub, floatMul, floatDiv, floatIntDiv, floatMod, floatPow,
+  floatLess, floatGreater, floatEqual, floatGrtEq, floatLessEq
+};
+
+const BinaryFn intFloatKernels[Value::NUM_OPS] = {
+  floatAdd, floatSub, floatMul, floatDiv, floatIntDiv, floatMod, floatPow,
+  intFloatLess, intFloatGreater, intFloatEqual, intFloatGrtEq, intFloatLessEq
+};
+
+const BinaryFn longKernels[Value::NUM_OPS] = {
+  longAdd, longSub, longMul, longDiv, longDiv, longMod, longPow,
+  longLess, longGreater, longEqual, longGrtEq, longLessEq
+};
+
+const BinaryFn mixedKernels[Value::NUM_OPS] = {
+  strAdd, typeError<Value::SUB>, strMul,
+  typeError<Value::DIV>, typeError<Value::INT_DIV>, typeError<Value::MOD>,
+  typeError<Value::POW>,
+  mixedLess, mixedGreater, mixedEqual, mixedGrtEq, mixedLessEq
+};
+
+const BinaryFn undefKernels[Value::NUM_OPS] = {
+  typeError<Value::ADD>, typeError<Value::SUB>, typeError<Value::MUL>,
+  typeError<Value::DIV>, typeError<Value::INT_DIV>, typeError<Value::MOD>,
+  typeError<Value::POW>, typeError<Value::LT>, typeError<Value::GT>,
+  typeError<Value::EQ>, typeError<Value::GE>, typeError<Value::LE>
+};
+
+// dispatch[op][type of lhs][type of rhs]
+struct DispatchTable {
+  DispatchTable();
+  BinaryFn fn[Value::NUM_OPS][Value::NUM_TYPES][Value::NUM_TYPES];
+};
+
+DispatchTable::DispatchTable() : fn() {
+  for (int op = 0; op < Value::NUM_OPS; ++op) {
+    for (int x = 0; x < Value::NUM_TYPES; ++x) {
+      for (int y = 0; y < Value::NUM_TYPES; ++y) {
+        if (x == Value::UNDEF || y == Value::UNDEF) {
+          fn[op][x][y] = undefKernels[op];
+        } else if (x == Value::NONE || y == Value::NONE || x == Value::STR || y == Value::STR) {
+          fn[op][x][y] = mixedKernels[op];
+        } else if (x == Value::FLOAT && y == Value::FLOAT) {
+          fn[op][x][y] = floatKernels[op];
+        } else if (x == Value::FLOAT || y == Value::FLOAT) {
+          fn[op][x][y] = intFloatKernels[op];
+        } else if (x == Value::LONG || y == Value::LONG) {
+          fn[op][x][y] = longKernels[op];
+        } else {
+          fn[op][x][y] = intKernels[op];
+        }
+      }
+    }
+  }
+}
+
+const DispatchTable dispatch;
+
+}
+
+Value Value::string(StrObject* s) {
+  Value res;
+  res.type = STR;
+  res.obj = s;
+  return res;
+}
+
+Value Value::longInt(LongObject* n) {
+  Value res;
+  res.type = LONG;
+  res.obj = n;
+  return res;
+}
+
+Value Value::integer(const BigInt& n) {
+  if (n.fitsLong()) return Value(n.toLong());
+  const std::vector<BigInt::Digit>& digits = n.getDigits();
+  return longInt(Heap::getInstance().newLong(n.isNegative(), digits.data(), digits.size()));
+}
+
+const StrObject* Value::getStr() const {
+  return static_cast<const StrObject*>(obj);
+}
+
+const LongObject* Value::getLong() const {
+  return static_cast<const LongObject*>(obj);
+}
+
+BigInt Value::toBigInt() const {
+  if (type == LONG) return BigInt(getLong()->isNegative(), getLong()->digits(), getLong()->length());
+  return BigInt(getInt());
+}
+
+double Value::longToFloat() const {
+  return toBigInt().toDouble();
+}
+
+Value Value::binary(Op op, const Value& x, const Value& y) {
+  return dispatch.fn[op][x.type][y.type](x, y);
+}
+
+Value Value::unary(char op) const {
+  switch (type) {
+    case BOOL:
+    case INT:
+      if (op == '-') return intSub(Value(0L), *this);
+      if (op == '~') return Value(~getInt());
+      return Value(getInt());
+    case LONG:
+      if (op == '-') return integer(-toBigInt());
+      if (op == '~') return integer(-toBigInt() - BigInt(1L));
+      return *this;
+    case FLOAT:
+      if (op == '-') return Value(-f);
+      if (op == '+') return *this;
+      break;
+    default:
+      break;
+  }
+  throw std::string("TypeError: bad operand type for unary ") + op + std::string(": '") + typeName() + std::string("'");
+}
+
+bool Value::boolValue() const {
+  switch (type) {
+    case BOOL: return b;
+    case INT: return i != 0;
+    case FLOAT: return f != 0.0;
+    case STR: return getStr()->length() != 0;
+    case LONG: return getLong()->length() != 0;
+    default: return false;
+  }
+}
+
+bool Value::isSame(const Value& other) const {
+  if (type != other.type) return false;
+  switch (type) {
+    case BOOL: return b == other.b;
+    case INT: return i == other.i;
+    case FLOAT: return std::memcmp(&f, &other.f, sizeof(f)) == 0;
+    case STR:
+    case LONG: return obj == other.obj;
+    default: return true;
+  }
+}
+
+const char* Value::typeName() const {
+  switch (type) {
+    case NONE: return "NoneType";
+    case BOOL: return "bool";
+    case INT: return "int";
+    case FLOAT: return "float";
+    case STR: return "str";
+    case LONG: return "long";
+    default: return "undefined";
+  }
+}
+
+// formats like Python 2's str()
+std::string Value::str() const {
+  switch (type) {
+    case NONE: return "None";
+    case BOOL: return b ? "True" : "False";
+    case INT: {
+      char buf[Writer::numberSize];
+      return std::string(buf, Writer::formatInt(i, buf));
+    }
+    case FLOAT: {
+      char buf[Writer::numberSize];
+      return std::string(buf, Writer::formatFloat(f, buf));
+    }
+    case STR: return std::string(getStr()->chars(), getStr()->length());
+    case LONG: return toBigInt().toString();
+    default:
+      throw std::string("print node eval is null");
+  }
+}
+
+void Value::print() const {
+  Writer& out = Interpreter::getInstance().getWriter();
+  switch (type) {
+    case INT: out.writeInt(i); break;
+    case FLOAT: out.writeFloat(f); break;
+    case STR: out.write(getStr()->chars(), getStr()->length()); break;
+    default: {
+      const std::string text = str();
+      out.write(text.data(), text.size());
+    }
+  }
+  out.newline();
+}
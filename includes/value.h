@@ -0,0 +1,68 @@
+#pragma once
+
+//  Runtime values. A Value is a small tagged struct holding
+//  ints, floats, bools and None inline, so arithmetic never
+//  allocates. Strings, and ints too large for a machine word
+//  (longs, see bigint.h), live on the collected heap (gc.h) and the
+//  Value points at them. Binary operators dispatch on the pair of
+//  operand types through a table built in value.cpp.
+
+#include <string>
+
+class BigInt;
+class Object;
+class StrObject;
+class LongObject;
+
+class Value {
+public:
+  // UNDEF is not a Python type: it marks a local that has been
+  // declared in a scope but not yet assigned. Heap types come last.
+  enum Type { UNDEF, NONE, BOOL, INT, FLOAT, STR, LONG, NUM_TYPES };
+  enum Op { ADD, SUB, MUL, DIV, INT_DIV, MOD, POW, LT, GT, EQ, GE, LE, NUM_OPS };
+
+  Value() : type(NONE), i(0) {}
+  explicit Value(long v) : type(INT), i(v) {}
+  explicit Value(double v) : type(FLOAT), f(v) {}
+  static Value boolean(bool v) { Value res; res.type = BOOL; res.b = v; return res; }
+  static Value undefined() { Value res; res.type = UNDEF; return res; }
+  static Value string(StrObject*);
+  static Value longInt(LongObject*);
+  // an int if n fits in a machine word, else a new long
+  static Value integer(const BigInt& n);
+
+  Type getType() const { return type; }
+  bool isUndefined() const { return type == UNDEF; }
+  long getInt() const { return type == BOOL ? b : i; }
+  double getFloat() const { return type == FLOAT ? f : type == LONG ? longToFloat() : getInt(); }
+  bool isNumber() const { return type == BOOL || type == INT || type == FLOAT; }
+  bool isObject() const { return type >= STR; }
+  Object* getObject() const { return obj; }
+  const StrObject* getStr() const;
+  const LongObject* getLong() const;
+  // an int, bool or long as a BigInt
+  BigInt toBigInt() const;
+
+  static Value binary(Op, const Value&, const Value&);
+  Value unary(char op) const;
+  bool boolValue() const;
+  // same type and same representation; constant strings are shared,
+  // so two of them are the same only if they are one object
+  bool isSame(const Value&) const;
+
+  const char* typeName() const;
+  std::string str() const;
+  void print() const;
+
+private:
+  // native code reads and writes Values in place
+  friend class JitCompiler;
+  double longToFloat() const;
+  Type type;
+  union {
+    long i;
+    double f;
+    bool b;
+    Object* obj;
+  };
+};
@@ -0,0 +1,403 @@
+#include <algorithm>
+#include "vm.h"
+#include "compiler.h"
+#include "ast.h"
+#include "gc.h"
+#include "interpreter.h"
+#include "jit.h"
+#include "memo.h"
+#include "poolOfNodes.h"
+#include "profiler.h"
+
+// computed goto where the compiler supports it, a plain switch otherwise
+#if defined(__GNUC__) && !defined(MYPY_NO_COMPUTED_GOTO)
+#define USE_COMPUTED_GOTO 1
+#endif
+
+#ifdef USE_COMPUTED_GOTO
+#define TARGET(op) L_##op:
+#define DISPATCH() goto *targets[pc->op]
+#else
+#define TARGET(op) case op:
+#define DISPATCH() continue
+#endif
+
+VirtualMachine& VirtualMachine::getInstance() {
+  static thread_local VirtualMachine vm;
+  return vm;
+}
+
+Value VirtualMachine::execute(const Node* stmt) {
+  Code code;
+  Compiler compiler(code);
+  compiler.compileStatement(stmt);
+  compiler.emit(RETURN_NONE);
+  return run(code);
+}
+
+void VirtualMachine::markRoots(Heap& heap) const {
+  for (unsigned long i = 0; i < top; ++i) {
+    heap.mark(stack[i]);
+  }
+}
+
+const Code& VirtualMachine::codeFor(const Node* suite) {
+  std::map<const Node*, Code*>::const_iterator it = compiled.find(suite);
+  if (it != compiled.end()) {
+    return *it->second;
+  }
+  // compiled code lives as long as the suite it was compiled from
+  Code* code = PoolOfNodes::getInstance().make<Code>();
+  Compiler compiler(*code);
+  compiler.compileStatement(suite);
+  compiler.emit(RETURN_NONE);
+  compiled[suite] = code;
+  return *code;
+}
+
+const Code& VirtualMachine::enter(const FuncNode* func, SymbolTable* scope, const Value* args, int argc) {
+  TableManager& tm = TableManager::getInstance();
+  tm.pushScope(scope, func->getFrameSize());
+  for (int i = 0; i < argc; ++i) {
+    tm.setLocal(i, args[i]);
+  }
+  // the arguments are still below top, so they stay rooted
+  Heap::getInstance().safepoint();
+  return codeFor(func->getSuite());
+}
+
+unsigned long VirtualMachine::reserve(const Code& code, int keep) {
+  const unsigned long base = top;
+  top += code.maxStack;
+  if (stack.size() <= top) {
+    stack.resize(2 * top + 16);
+  }
+  // slots above the operands are scanned by the collector too, so they
+  // must not hold values left over from an earlier frame
+  std::fill(&stack[base] + keep, &stack[base] + code.maxStack, Value());
+  return base;
+}
+
+Value VirtualMachine::call(const FuncNode* func, SymbolTable* scope, const Value* args, int argc) {
+  TableManager& tm = TableManager::getInstance();
+  Jit& jit = Jit::getInstance();
+  Profiler& profiler = Profiler::getInstance();
+  ScopeGuard frame(tm);
+  ProfileGuard profiled(profiler);
+  Unwind unwind(*this);
+  if (profiler.isEnabled()) profiler.enter(func);
+  const Code& code = enter(func, scope, args, argc);
+  Value result;
+  if (NativeCode native = jit.enter(code)) {
+    const unsigned long base = reserve(code, 0);
+    JitFrame jf{&stack[base], tm.currentTable()->getSlots(), tm.getGlobals(), &code, base, Value(), 0, 0};
+    const Jit::Status status = jit.run(native, jf);
+    top = base;
+    if (status == Jit::FAILED) jit.rethrow();
+    result = status == Jit::RETURNED ? jf.result : run(code, jf.pc, jf.sp);
+  }
+  else {
+    result = run(code);
+  }
+  return result;
+}
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif
+
+Value VirtualMachine::run(const Code& entry, int entryPc, int entryDepth) {
+  TableManager& tm = TableManager::getInstance();
+  Memo& memo = Memo::getInstance();
+  Jit& jit = Jit::getInstance();
+  Profiler& profiler = Profiler::getInstance();
+  // calls below this depth belong to whoever called run
+  const unsigned long outer = frames.size();
+  // an error leaves no call made in this loop behind
+  ScopeGuard scopes(tm);
+  ProfileGuard profiled(profiler);
+  Unwind unwind(*this);
+  const Code* code = &entry;
+  const Instruction* start = nullptr;
+  const Instruction* pc = nullptr;
+  const Value* constants = nullptr;
+  SymbolTable* frame = nullptr;
+  unsigned long base = 0;
+  Value* sp = nullptr;
+  Value result;
+
+// start running code from its first instruction in the current scope,
+// with its part of the operand stack reserved above top
+#define ENTER_CODE() do { \
+    start = code->instructions.data(); \
+    pc = start; \
+    constants = code->constants.data(); \
+    frame = tm.currentTable(); \
+    base = reserve(*code, 0); \
+    sp = &stack[base]; \
+  } while (0)
+
+// run a function body natively if the JIT has compiled it: to its return,
+// or up to the instruction where a guard failed, and interpret from there
+#define RUN_NATIVE() do { \
+    if (NativeCode native = jit.enter(*code)) { \
+      JitFrame jf{sp, frame->getSlots(), tm.getGlobals(), code, base, Value(), 0, 0}; \
+      const Jit::Status status = jit.run(native, jf); \
+      if (status == Jit::RETURNED) { \
+        result = jf.result; \
+        goto leave; \
+      } \
+      if (status == Jit::FAILED) jit.rethrow(); \
+      pc = start + jf.pc; \
+      sp = &stack[base] + jf.sp; \
+    } \
+  } while (0)
+
+  start = code->instructions.data();
+  pc = start + entryPc;
+  constants = code->constants.data();
+  frame = tm.currentTable();
+  base = reserve(*code, entryDepth);
+  sp = &stack[base] + entryDepth;
+
+#ifdef USE_COMPUTED_GOTO
+  static void* const targets[] = {
+    &&L_LOAD_CONST, &&L_LOAD_LOCAL, &&L_STORE_LOCAL, &&L_LOAD_ENCLOSING,
+    &&L_LOAD_GLOBAL, &&L_STORE_GLOBAL,
+    &&L_BINARY_ADD, &&L_BINARY_SUB, &&L_BINARY_MUL, &&L_BINARY_DIV,
+    &&L_BINARY_INT_DIV, &&L_BINARY_MOD, &&L_BINARY_POW,
+    &&L_COMPARE_LT, &&L_COMPARE_GT, &&L_COMPARE_EQ, &&L_COMPARE_GE, &&L_COMPARE_LE,
+    &&L_UNARY_OP, &&L_PRINT_ITEM, &&L_PRINT_NEWLINE, &&L_POP_TOP, &&L_DUP_TOP,
+    &&L_JUMP, &&L_JUMP_IF_FALSE, &&L_MAKE_FUNCTION, &&L_CALL_FUNCTION,
+    &&L_RETURN_VALUE, &&L_RETURN_NONE
+  };
+  DISPATCH();
+#else
+  for (;;) switch (pc->op) {
+#endif
+
+  TARGET(LOAD_CONST) {
+    *sp++ = constants[pc->arg];
+    ++pc;
+    DISPATCH();
+  }
+  TARGET(LOAD_LOCAL) {
+    const Value& val = frame->getSlot(pc->arg);
+    if (val.isUndefined()) {
+      IdentNode::unbound(code->nameOf(Location::LOCAL, pc->arg), Location{Location::LOCAL, 0, pc->arg});
+    }
+    *sp++ = val;
+    ++pc;
+    DISPATCH();
+  }
+  TARGET(STORE_LOCAL) {
+    frame->setSlot(pc->arg, *--sp);
+    ++pc;
+    DISPATCH();
+  }
+  TARGET(LOAD_ENCLOSING) {
+    const Variable& var = code->variables[pc->arg];
+    const Value& val = tm.getEnclosing(var.loc.depth, var.loc.slot);
+    if (val.isUndefined()) {
+      IdentNode::unbound(var.name->str(), var.loc);
+    }
+    *sp++ = val;
+    ++pc;
+    DISPATCH();
+  }
+  TARGET(LOAD_GLOBAL) {
+    const Value& val = tm.getGlobal(pc->arg);
+    if (val.isUndefined()) {
+      IdentNode::unbound(code->nameOf(Location::GLOBAL, pc->arg), Location{Location::GLOBAL, 0, pc->arg});
+    }
+    *sp++ = val;
+    ++pc;
+    DISPATCH();
+  }
+  TARGET(STORE_GLOBAL) {
+    tm.setGlobal(pc->arg, *--sp);
+    ++pc;
+    DISPATCH();
+  }
+  TARGET(BINARY_ADD) {
+    --sp;
+    sp[-1] = Value::binary(Value::ADD, sp[-1], *sp);
+    ++pc;
+    DISPATCH();
+  }
+  TARGET(BINARY_SUB) {
+    --sp;
+    sp[-1] = Value::binary(Value::SUB, sp[-1], *sp);
+    ++pc;
+    DISPATCH();
+  }
+  TARGET(BINARY_MUL) {
+    --sp;
+    sp[-1] = Value::binary(Value::MUL, sp[-1], *sp);
+    ++pc;
+    DISPATCH();
+  }
+  TARGET(BINARY_DIV) {
+    --sp;
+    sp[-1] = Value::binary(Value::DIV, sp[-1], *sp);
+    ++pc;
+    DISPATCH();
+  }
+  TARGET(BINARY_INT_DIV) {
+    --sp;
+    sp[-1] = Value::binary(Value::INT_DIV, sp[-1], *sp);
+    ++pc;
+    DISPATCH();
+  }
+  TARGET(BINARY_MOD) {
+    --sp;
+    sp[-1] = Value::binary(Value::MOD, sp[-1], *sp);
+    ++pc;
+    DISPATCH();
+  }
+  TARGET(BINARY_POW) {
+    --sp;
+    sp[-1] = Value::binary(Value::POW, sp[-1], *sp);
+    ++pc;
+    DISPATCH();
+  }
+  TARGET(COMPARE_LT) {
+    --sp;
+    sp[-1] = Value::binary(Value::LT, sp[-1], *sp);
+    ++pc;
+    DISPATCH();
+  }
+  TARGET(COMPARE_GT) {
+    --sp;
+    sp[-1] = Value::binary(Value::GT, sp[-1], *sp);
+    ++pc;
+    DISPATCH();
+  }
+  TARGET(COMPARE_EQ) {
+    --sp;
+    sp[-1] = Value::binary(Value::EQ, sp[-1], *sp);
+    ++pc;
+    DISPATCH();
+  }
+  TARGET(COMPARE_GE) {
+    --sp;
+    sp[-1] = Value::binary(Value::GE, sp[-1], *sp);
+    ++pc;
+    DISPATCH();
+  }
+  TARGET(COMPARE_LE) {
+    --sp;
+    sp[-1] = Value::binary(Value::LE, sp[-1], *sp);
+    ++pc;
+    DISPATCH();
+  }
+  TARGET(UNARY_OP) {
+    sp[-1] = sp[-1].unary(static_cast<char>(pc->arg));
+    ++pc;
+    DISPATCH();
+  }
+  TARGET(PRINT_ITEM) {
+    (--sp)->print();
+    ++pc;
+    DISPATCH();
+  }
+  TARGET(PRINT_NEWLINE) {
+    Interpreter::getInstance().getWriter().newline();
+    ++pc;
+    DISPATCH();
+  }
+  TARGET(POP_TOP) {
+    --sp;
+    ++pc;
+    DISPATCH();
+  }
+  TARGET(DUP_TOP) {
+    *sp = sp[-1];
+    ++sp;
+    ++pc;
+    DISPATCH();
+  }
+  TARGET(JUMP) {
+    pc = start + pc->arg;
+    DISPATCH();
+  }
+  TARGET(JUMP_IF_FALSE) {
+    --sp;
+    pc = sp->boolValue() ? pc + 1 : start + pc->arg;
+    DISPATCH();
+  }
+  TARGET(MAKE_FUNCTION) {
+    const FuncNode* func = code->functions[pc->arg];
+    tm.setFunc(func->getName(), func);
+    ++pc;
+    DISPATCH();
+  }
+  TARGET(CALL_FUNCTION) {
+    const CallSite& site = code->calls[pc->arg];
+    sp -= site.argc;
+    SymbolTable* scope = nullptr;
+    const FuncNode* func = tm.getFunc(site.name, &scope, site.cache);
+    CallNode::checkArguments(site.name->str(), func->getParams().size(), site.argc);
+    const bool memoized = memo.applies(func, sp, site.argc);
+    if (memoized && memo.find(func, sp, site.argc, result)) {
+      *sp++ = result;
+      ++pc;
+      DISPATCH();
+    }
+    if (profiler.isEnabled()) {
+      profiler.at(code->lineAt(pc - start));
+      profiler.enter(func);
+    }
+    const Code& callee = enter(func, scope, sp, site.argc);
+    // the callee may grow the stack, so the caller's position is kept as an offset
+    frames.push_back(Frame{code, pc + 1, base, static_cast<unsigned long>(sp - &stack[0]),
+                           memoized ? func : nullptr, site.argc});
+    code = &callee;
+    ENTER_CODE();
+    RUN_NATIVE();
+    DISPATCH();
+  }
+  TARGET(RETURN_VALUE) {
+    result = *--sp;
+    goto leave;
+  }
+  TARGET(RETURN_NONE) {
+    result = Value();
+    goto leave;
+  }
+
+  leave: {
+    top = base;
+    if (frames.size() == outer) {
+      return result;
+    }
+    if (profiler.isEnabled()) {
+      profiler.at(code->lineAt(pc - start));
+      profiler.leave();
+    }
+    tm.popScope();
+    const Frame& caller = frames.back();
+    code = caller.code;
+    start = code->instructions.data();
+    pc = caller.pc;
+    constants = code->constants.data();
+    frame = tm.currentTable();
+    base = caller.base;
+    sp = &stack[caller.sp];
+    if (caller.memo) memo.store(caller.memo, sp, caller.argc, result);
+    *sp++ = result;
+    frames.pop_back();
+    DISPATCH();
+  }
+
+#ifndef USE_COMPUTED_GOTO
+  }
+#endif
+#undef ENTER_CODE
+#undef RUN_NATIVE
+}
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
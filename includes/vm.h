@@ -0,0 +1,83 @@
+#pragma once
+
+#include <map>
+#include <vector>
+#include "bytecode.h"
+
+class Node;
+class Heap;
+class FuncNode;
+class SymbolTable;
+
+class VirtualMachine {
+public:
+  static VirtualMachine& getInstance();
+
+  // compile a top-level statement and run it
+  Value execute(const Node*);
+  // returns the value of RETURN_VALUE, None if the code falls off the end;
+  // calls made by the code run in the same loop, without native recursion,
+  // or as native code when the JIT has compiled the callee. Code is run
+  // from instruction pc with depth operands already on its stack.
+  Value run(const Code&, int pc = 0, int depth = 0);
+  // a call made from native code (jit.cpp): runs the function to its return
+  Value call(const FuncNode*, SymbolTable* scope, const Value* args, int argc);
+  Value* stackAt(unsigned long offset) { return &stack[offset]; }
+  // drops every active call, after an error reached the top level
+  void reset() {
+    frames.clear();
+    top = 0;
+  }
+  // the reserved part of the operand stack of every active code object
+  void markRoots(Heap&) const;
+
+  VirtualMachine(const VirtualMachine&) = delete;
+  VirtualMachine& operator=(const VirtualMachine&) = delete;
+private:
+  VirtualMachine() : compiled(), stack(), top(0), frames() {}
+
+  // pushes the callee's scope and binds the arguments, returns its code
+  const Code& enter(const FuncNode*, SymbolTable* scope, const Value* args, int argc);
+  // function bodies are compiled on their first call and cached
+  const Code& codeFor(const Node* suite);
+  // reserves code's part of the operand stack above top, clearing all
+  // but its first keep slots, and returns where it starts
+  unsigned long reserve(const Code&, int keep);
+
+  // Puts the operand stack and the callers back as they were when it
+  // was made, as an error unwinds through run or call; the scopes and
+  // the profiler go with their own guards. On a normal return they are
+  // already back.
+  class Unwind {
+  public:
+    explicit Unwind(VirtualMachine& v) : vm(v), outer(v.frames.size()), top(v.top) {}
+    ~Unwind() {
+      vm.frames.resize(outer);
+      vm.top = top;
+    }
+    Unwind(const Unwind&) = delete;
+    Unwind& operator=(const Unwind&) = delete;
+  private:
+    VirtualMachine& vm;
+    unsigned long outer;
+    unsigned long top;
+  };
+
+  // where a caller resumes once its callee returns
+  struct Frame {
+    const Code* code;
+    const Instruction* pc;  // the instruction after the call
+    unsigned long base;     // start of the caller's part of the stack
+    unsigned long sp;       // where the result goes, as an offset
+    // set if the result is to be memoized, the arguments are still at sp
+    const FuncNode* memo;
+    int argc;
+  };
+
+  std::map<const Node*, Code*> compiled;
+  // operand stack shared by all active code objects, top is the first free slot
+  std::vector<Value> stack;
+  unsigned long top;
+  // callers of the active calls, innermost last
+  std::vector<Frame> frames;
+};
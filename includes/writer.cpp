@@ -0,0 +1,207 @@
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <ostream>
+#include <sys/uio.h>
+#include <unistd.h>
+#include "writer.h"
+
+namespace {
+
+const char digitPairs[] =
+  "0001020304050607080910111213141516171819202122232425262728293031323334353637383940414243444546474849"
+  "5051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+
+}
+
+Writer::Writer() :
+  std::streambuf(), buffer(new char[capacity]), fd(STDOUT_FILENO), stream(nullptr),
+  lineBuffered(false) {
+  setp(buffer, buffer + capacity);
+}
+
+Writer::~Writer() {
+  // not flush(): a host's stream may be gone by now, and there is
+  // nothing of the last run left for it
+  flushBuffer();
+  delete [] buffer;
+}
+
+void Writer::setSink(int to) {
+  flush();
+  fd = to;
+  stream = nullptr;
+}
+
+void Writer::setSink(std::ostream& out) {
+  flush();
+  stream = &out;
+}
+
+void Writer::write(const char* text, unsigned long length) {
+  if (length <= static_cast<unsigned long>(epptr() - pptr())) {
+    std::memcpy(pptr(), text, length);
+    pbump(length);
+  }
+  else if (length < capacity / 2) {
+    flushBuffer();
+    std::memcpy(pptr(), text, length);
+    pbump(length);
+  }
+  else {
+    writeOut(text, length);
+  }
+}
+
+void Writer::writeInt(long value) {
+  if (static_cast<unsigned long>(epptr() - pptr()) < numberSize) flushBuffer();
+  pbump(formatInt(value, pptr()));
+}
+
+void Writer::writeFloat(double value) {
+  if (static_cast<unsigned long>(epptr() - pptr()) < numberSize) flushBuffer();
+  pbump(formatFloat(value, pptr()));
+}
+
+void Writer::flush() {
+  flushBuffer();
+  if (stream) stream->flush();
+}
+
+void Writer::flushBuffer() {
+  if (pptr() > pbase()) writeOut(nullptr, 0);
+}
+
+// what is buffered, then text
+void Writer::writeOut(const char* text, unsigned long length) {
+  const unsigned long buffered = pptr() - pbase();
+  setp(buffer, buffer + capacity);
+  if (stream) {
+    stream->write(buffer, buffered);
+    stream->write(text, length);
+    return;
+  }
+  // anything written through stdio, like std::cout, goes first
+  std::fflush(stdout);
+  struct iovec parts[2] = { { buffer, buffered }, { const_cast<char*>(text), length } };
+  struct iovec* part = parts;
+  int count = 2;
+  while (count) {
+    ssize_t written = writev(fd, part, count);
+    if (written < 0 && errno == EINTR) continue;
+    // as with a stream in a bad state, the output is lost
+    if (written < 0) return;
+    for (; count && static_cast<size_t>(written) >= part->iov_len; ++part, --count) {
+      written -= part->iov_len;
+    }
+    if (count) {
+      part->iov_base = static_cast<char*>(part->iov_base) + written;
+      part->iov_len -= written;
+    }
+  }
+}
+
+int Writer::overflow(int c) {
+  flushBuffer();
+  if (c != traits_type::eof()) {
+    *pptr() = traits_type::to_char_type(c);
+    pbump(1);
+  }
+  return traits_type::not_eof(c);
+}
+
+std::streamsize Writer::xsputn(const char* text, std::streamsize length) {
+  write(text, length);
+  return length;
+}
+
+int Writer::sync() {
+  flush();
+  return 0;
+}
+
+unsigned long Writer::formatInt(long value, char* to) {
+  char digits[20];
+  char* first = digits + sizeof digits;
+  // in unsigned, where the most negative long has a magnitude
+  unsigned long n = value < 0 ? 0ul - static_cast<unsigned long>(value) : value;
+  while (n >= 100) {
+    first -= 2;
+    std::memcpy(first, digitPairs + 2 * (n % 100), 2);
+    n /= 100;
+  }
+  if (n >= 10) {
+    first -= 2;
+    std::memcpy(first, digitPairs + 2 * n, 2);
+  }
+  else {
+    *--first = static_cast<char>('0' + n);
+  }
+  unsigned long length = 0;
+  if (value < 0) to[length++] = '-';
+  const unsigned long count = digits + sizeof digits - first;
+  std::memcpy(to + length, first, count);
+  return length + count;
+}
+
+unsigned long Writer::formatFloat(double value, char* to) {
+  // C prints a negative NaN as -nan, Python as nan
+  if (std::isnan(value)) {
+    std::memcpy(to, "nan", 3);
+    return 3;
+  }
+  // a whole number of up to 11 digits is printed in full, and most are
+  if (value == std::floor(value) && std::fabs(value) < 1e11) {
+    unsigned long length = 0;
+    if (std::signbit(value)) to[length++] = '-';
+    length += formatInt(static_cast<long>(std::fabs(value)), to + length);
+    to[length++] = '.';
+    to[length++] = '0';
+    return length;
+  }
+  // CPython's dtoa keeps the zeros of a whole number that lies exactly
+  // halfway and goes down to an even 12th digit: 1000000000005.0 is
+  // 1.00000000000e+12, 1000000000004.0 is 1e+12
+  if (value == std::floor(value) && std::fabs(value) >= 1e12 && std::fabs(value) < 1e15) {
+    const long whole = static_cast<long>(std::fabs(value));
+    long unit = 10;
+    int exponent = 12;
+    for (; whole / unit >= 1000000000000l; unit *= 10) ++exponent;
+    if (whole % unit * 2 == unit && whole / unit % 2 == 0) {
+      char digits[numberSize];
+      formatInt(whole / unit, digits);
+      unsigned long length = 0;
+      if (value < 0) to[length++] = '-';
+      to[length++] = digits[0];
+      to[length++] = '.';
+      std::memcpy(to + length, digits + 1, 11);
+      length += 11;
+      return length + std::snprintf(to + length, numberSize - length, "e+%d", exponent);
+    }
+  }
+  unsigned long length = std::snprintf(to, numberSize, "%.12g", value);
+  // C goes to an exponent past 12 digits before the point, Python past
+  // 11, leaving room for the ".0"
+  const char* digits = to + (to[0] == '-');
+  const char* point = static_cast<const char*>(std::memchr(to, '.', length));
+  if (!std::memchr(to, 'e', length) && (point ? point : to + length) - digits == 12) {
+    char mantissa[numberSize];
+    std::snprintf(mantissa, sizeof mantissa, "%.11e", value);
+    // as %g does, without the zeros the mantissa ends in
+    char* exponent = std::strchr(mantissa, 'e');
+    char* last = exponent - 1;
+    while (*last == '0') --last;
+    if (*last == '.') --last;
+    length = last + 1 - mantissa;
+    std::memcpy(to, mantissa, length);
+    const unsigned long rest = std::strlen(exponent);
+    std::memcpy(to + length, exponent, rest);
+    return length + rest;
+  }
+  if (!std::memchr(to, '.', length) && !std::memchr(to, 'e', length) && !std::memchr(to, 'n', length)) {
+    to[length++] = '.';
+    to[length++] = '0';
+  }
+  return length;
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+//  The buffer print writes through. Output collects in a large buffer
+//  and goes out when it fills, on flush(), and when a script is done
+//  (Interpreter flushes after each run), instead of once a line as
+//  std::endl did. A write too big for the buffer goes out with what is
+//  buffered in one writev(), without being copied.
+//
+//  The sink is standard output, written with system calls, or a stream
+//  a host has given (see Interpreter::setOutput). Line buffering, one
+//  flush a newline, is for a terminal and only on request.
+//
+//  Numbers are formatted into a buffer on the stack, as Python 2 does
+//  for str(): ints in full, floats to 12 significant digits with ".0"
+//  added to whole numbers.
+//
+//  Writer is also a streambuf, so whatever is written through the
+//  interpreter's output stream, like error messages, keeps its order
+//  with what print wrote.
+
+#include <iosfwd>
+#include <streambuf>
+
+class Writer : public std::streambuf {
+public:
+  static const unsigned long capacity = 64 * 1024;
+  // enough for any formatted int or float
+  static const unsigned long numberSize = 32;
+
+  Writer();
+  ~Writer();
+
+  // standard output, with system calls
+  void setSink(int fd);
+  void setSink(std::ostream& out);
+  void setLineBuffered(bool on) { lineBuffered = on; }
+
+  void write(const char* text, unsigned long length);
+  void writeInt(long value);
+  void writeFloat(double value);
+  void newline() {
+    if (pptr() == epptr()) flushBuffer();
+    *pptr() = '\n';
+    pbump(1);
+    if (lineBuffered) flush();
+  }
+  void flush();
+
+  // the text of value in to, not NUL-terminated; its length
+  static unsigned long formatInt(long value, char* to);
+  static unsigned long formatFloat(double value, char* to);
+
+  Writer(const Writer&) = delete;
+  Writer& operator=(const Writer&) = delete;
+protected:
+  virtual int overflow(int c);
+  virtual std::streamsize xsputn(const char* text, std::streamsize length);
+  virtual int sync();
+private:
+  // writes out what is buffered, without flushing the sink stream
+  void flushBuffer();
+  void writeOut(const char* text, unsigned long length);
+
+  // the streambuf's put area
+  char* buffer;
+  int fd;
+  std::ostream* stream;
+  bool lineBuffered;
+};
@@ -0,0 +1,166 @@
+#include <cerrno>
+// Hand-written stand-in for the flex scanner (sandbox has no flex).
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "includes/ast.h"
+#include "includes/interpreter.h"
+#include <iostream>
+#include "parse.tab.h"
+
+static thread_local char* yytext = nullptr;
+static thread_local int yylineno = 1;
+static thread_local YYSTYPE yylval;
+static thread_local YYLTYPE yylloc = {1, 1, 1, 1};
+static thread_local std::string src;
+static thread_local size_t pos = 0;
+static thread_local std::vector<int> indents;
+static thread_local std::vector<int> pending;
+static thread_local int level = 0;
+static thread_local bool atbol = true;
+static thread_local bool done = false;
+static thread_local bool lineHasTokens = false;
+static thread_local std::string textbuf;
+
+yyscan_t init_scanner(Source& s) {
+  src.assign(s.data(), s.size()); pos = 0; indents.assign(1, 0); pending.clear(); level = 0;
+  atbol = true; done = false; lineHasTokens = false; yylineno = 1;
+  return &src;
+}
+void end_scanner(yyscan_t) {}
+char* yyget_text(yyscan_t) { return yytext; }
+
+static void settext(size_t b, size_t e) {
+  textbuf = src.substr(b, e - b);
+  yytext = const_cast<char*>(textbuf.c_str());
+  yylloc.first_line = yylloc.last_line = yylineno;
+}
+
+struct Kw { const char* s; int t; };
+static const Kw kws[] = {
+  {"and",AND},{"not",NOT},{"or",OR},{"as",AS},{"assert",ASSERT},{"break",BREAK},
+  {"class",CLASS},{"continue",CONTINUE},{"def",DEF},{"del",DEL},{"elif",ELIF},
+  {"else",ELSE},{"except",EXCEPT},{"exec",EXEC},{"finally",FINALLY},{"for",FOR},
+  {"from",FROM},{"global",GLOBAL},{"if",IF},{"import",IMPORT},{"in",IN},{"is",IS},
+  {"lambda",LAMBDA},{"pass",PASS},{"print",PRINT},{"raise",RAISE},{"return",RETURN},
+  {"try",TRY},{"while",WHILE},{"with",WITH},{"yield",YIELD},{nullptr,0}};
+struct Op { const char* s; int t; };
+static const Op ops[] = {
+  {"<<=",LEFTSHIFTEQUAL},{">>=",RIGHTSHIFTEQUAL},{"**=",DOUBLESTAREQUAL},{"//=",DOUBLESLASHEQUAL},
+  {"==",EQEQUAL},{"!=",NOTEQUAL},{"<=",LESSEQUAL},{">=",GREATEREQUAL},{"<>",GRLT},
+  {"<<",LEFTSHIFT},{">>",RIGHTSHIFT},{"**",DOUBLESTAR},{"+=",PLUSEQUAL},{"-=",MINEQUAL},
+  {"*=",STAREQUAL},{"/=",SLASHEQUAL},{"%=",PERCENTEQUAL},{"&=",AMPEREQUAL},{"|=",VBAREQUAL},
+  {"^=",CIRCUMFLEXEQUAL},{"//",DOUBLESLASH},
+  {"(",LPAR},{")",RPAR},{"[",LSQB},{"]",RSQB},{"{",LBRACE},{"}",RBRACE},{":",COLON},
+  {",",COMMA},{";",SEMI},{"+",PLUS},{"-",MINUS},{"*",STAR},{"/",SLASH},{"<",LESS},
+  {">",GREATER},{"=",EQUAL},{".",DOT},{"%",PERCENT},{"`",BACKQUOTE},{"~",TILDE},
+  {"^",CIRCUMFLEX},{"|",BAR},{"&",AMPERSAND},{"@",AT},{nullptr,0}};
+
+static int raw() {
+  for (;;) {
+    if (atbol) {
+      // measure indentation, skip blank/comment lines
+      size_t p = pos; int col = 0;
+      while (p < src.size() && (src[p] == ' ' || src[p] == '\t')) { col += src[p]=='\t' ? 8 - col%8 : 1; ++p; }
+      if (p < src.size() && (src[p] == '\n' || src[p] == '#' || src[p] == '\r')) {
+        while (p < src.size() && src[p] != '\n') ++p;
+        if (p < src.size()) { ++p; ++yylineno; }
+        pos = p; continue;
+      }
+      pos = p; atbol = false;
+      if (p >= src.size()) col = 0;
+      if (level == 0) {
+        if (col > indents.back()) { indents.push_back(col); pending.push_back(INDENT); }
+        else while (col < indents.back()) { indents.pop_back(); pending.push_back(DEDENT); }
+      }
+      if (!pending.empty()) { int t = pending.front(); pending.erase(pending.begin()); return t; }
+    }
+    if (!pending.empty()) { int t = pending.front(); pending.erase(pending.begin()); return t; }
+    while (pos < src.size() && (src[pos] == ' ' || src[pos] == '\t' || src[pos] == '\f')) ++pos;
+    if (pos < src.size() && src[pos] == '#') { while (pos < src.size() && src[pos] != '\n') ++pos; }
+    if (pos >= src.size()) {
+      if (done) return 0;
+      if (lineHasTokens) { lineHasTokens = false; return NEWLINE; }
+      if (indents.size() > 1) { indents.pop_back(); return DEDENT; }
+      done = true; return ENDMARKER;
+    }
+    char c = src[pos];
+    if (c == '\\' && pos + 1 < src.size() && src[pos+1] == '\n') { pos += 2; ++yylineno; continue; }
+    if (c == '\n' || c == '\r') {
+      ++pos; if (c == '\r' && pos < src.size() && src[pos] == '\n') ++pos;
+      ++yylineno;
+      if (level > 0) continue;
+      atbol = true;
+      if (lineHasTokens) { lineHasTokens = false; return NEWLINE; }
+      continue;
+    }
+    lineHasTokens = true;
+    size_t b = pos;
+    if (isalpha((unsigned char)c) || c == '_') {
+      // string prefix?
+      size_t q = pos; while (q < src.size() && (isalnum((unsigned char)src[q]) || src[q] == '_')) ++q;
+      if (q < src.size() && (src[q] == '"' || src[q] == '\'') && q - pos <= 2) { goto str; }
+      pos = q; settext(b, pos);
+      for (const Kw* k = kws; k->s; ++k) if (textbuf == k->s) return k->t;
+      yylval.atom = Interner::getInstance().intern(textbuf);
+      return NAME;
+    }
+    if (isdigit((unsigned char)c) || (c == '.' && pos + 1 < src.size() && isdigit((unsigned char)src[pos+1]))) {
+      size_t q = pos; bool flt = false;
+      if (c == '0' && q + 1 < src.size() && (src[q+1] == 'x' || src[q+1] == 'X')) {
+        q += 2; while (q < src.size() && isxdigit((unsigned char)src[q])) ++q;
+        pos = q; settext(b, pos); yylval.intNumber = atoi(yytext); return INT;
+      }
+      while (q < src.size() && isdigit((unsigned char)src[q])) ++q;
+      if (q < src.size() && src[q] == '.') { flt = true; ++q; while (q < src.size() && isdigit((unsigned char)src[q])) ++q; }
+      if (q < src.size() && (src[q] == 'e' || src[q] == 'E')) { flt = true; ++q; if (src[q]=='+'||src[q]=='-') ++q; while (q < src.size() && isdigit((unsigned char)src[q])) ++q; }
+      if (!flt && q < src.size() && (src[q] == 'l' || src[q] == 'L')) { ++q; }
+      else if (q < src.size() && (src[q] == 'l' || src[q] == 'L' || src[q] == 'j' || src[q] == 'J')) { ++q; pos = q; settext(b,pos); return NUMBER; }
+      pos = q; settext(b, pos);
+      if (flt) { yylval.fltNumber = atof(yytext); return FLOAT; }
+      {
+        int digits = textbuf.size();
+        if (yytext[digits-1] == 'l' || yytext[digits-1] == 'L') --digits;
+        errno = 0; char* end = nullptr; long v = strtol(yytext, &end, 10);
+        if (errno != ERANGE && end == yytext + digits) { yylval.intNumber = v; return INT; }
+        yylval.view.text = src.data() + b; yylval.view.length = digits; return LONGINT;
+      }
+    }
+    if (c == '"' || c == '\'') {
+    str:
+      while (pos < src.size() && src[pos] != '"' && src[pos] != '\'') ++pos;
+      char qch = src[pos];
+      bool tri = src.compare(pos, 3, std::string(3, qch)) == 0;
+      pos += tri ? 3 : 1;
+      for (;;) {
+        if (pos >= src.size()) { fprintf(stderr, "unterminated string\n"); exit(1); }
+        if (src[pos] == '\\') { pos += 2; continue; }
+        if (src[pos] == '\n') ++yylineno;
+        if (tri ? src.compare(pos, 3, std::string(3, qch)) == 0 : src[pos] == qch) { pos += tri ? 3 : 1; break; }
+        ++pos;
+      }
+      settext(b, pos);
+      if (tri) { yylval.view.text = nullptr; return STRING; }
+      yylval.view.text = src.data() + b; yylval.view.length = pos - b;
+      return STRING;
+    }
+    for (const Op* o = ops; o->s; ++o) {
+      size_t n = strlen(o->s);
+      if (src.compare(pos, n, o->s) == 0) {
+        pos += n; settext(b, pos);
+        if (o->t == LPAR || o->t == LSQB || o->t == LBRACE) ++level;
+        if (o->t == RPAR || o->t == RSQB || o->t == RBRACE) --level;
+        return o->t;
+      }
+    }
+    settext(b, b + 1);
+    Interpreter::getInstance().getErrors() << "lexical error with [" << yytext << "]: unknown character" << std::endl;
+    throw ScanError();
+  }
+}
+
+int yylex(YYSTYPE* lval, YYLTYPE* lloc, yyscan_t) {
+  int t = raw(); *lval = yylval; *lloc = yylloc; return t;
+}
@@ -26,50 +26,300 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <sys/resource.h>
+#include <atomic>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
 #include "includes/ast.h"
+#include "includes/constants.h"
+#include "includes/gc.h"
+#include "includes/interpreter.h"
+#include "includes/jit.h"
+#include "includes/memo.h"
+#include "includes/profiler.h"
+#include "includes/quicken.h"
+#include "includes/server.h"
 
-extern int yyparse();
-extern void end_scanner();
-extern void init_scanner(FILE *);
 extern "C" {
   int yydebug;
 }
 
-static FILE *open_file(const char *filename) {
-  FILE *file = fopen(filename, "r");
-  if (!file) {
-    fprintf(stderr, "Could not open file \"%s\"\n", filename);
-    exit(EXIT_FAILURE);
+// one sample a millisecond, for --profile=lines
+static const unsigned long sampleInterval = 1000;
+
+static void usage(const char *prog) {
+  fprintf(stderr, "usage: %s [--engine=ast|vm] [--mem-stats] [--gc-stats] "
+                  "[--gc-threshold=BYTES] [--recursion-limit=N] [--dump-ast] "
+                  "[--cache-stats] [--no-cache] [--memoize[=ENTRIES]] "
+                  "[--warmup=N] [--dump-quick] [--jit=off|on|threshold=N] "
+                  "[--jit-stats] [--profile[=lines]] [--profile-stacks=FILE] [--no-mmap] "
+                  "[--line-buffered] [--jobs=N] [file ...]\n"
+                  "       %s --serve SOCKET [--jobs=N] [options]\n"
+                  "       %s --connect SOCKET [file]\n", prog, prog, prog);
+  exit(EXIT_FAILURE);
+}
+
+// peak resident set in KB; /proc leaves out what a parent that forked
+// this process had resident before the exec
+static long peakRss() {
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.compare(0, 6, "VmHWM:") == 0) return strtol(line.c_str() + 6, nullptr, 10);
   }
-  return file;
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss;
 }
 
-NullNode* NullNode::instance = nullptr;
+static void printMemStats() {
+  std::cerr << std::left << std::setw(10) << "region" << std::right
+            << std::setw(12) << "in use"
+            << std::setw(12) << "peak"
+            << std::setw(14) << "allocated"
+            << std::setw(12) << "reserved"
+            << std::setw(8) << "chunks" << std::endl;
+  PoolOfNodes::getInstance().getArena().printStats(std::cerr);
+  Scratch::getInstance().printStats(std::cerr);
+  TableManager::getInstance().getFrameArena().printStats(std::cerr);
+  TableManager::getInstance().printFrameStats(std::cerr);
+  ConstantPool::getInstance().printStats(std::cerr);
+  std::cerr << "rss: peak " << peakRss() << " KB" << std::endl;
+}
 
-int main(int argc, char * argv[]) {
-  FILE *input_file = stdin;
-  if (argc > 1) { /* user-supplied filename */
-    input_file = open_file(argv[1]);
+// runs the script in file, or stdin, on the server at socket: a file
+// is sent by its path, so the server's cache of it is used
+static int run_remote(const char* socket, const char* file) {
+  if (file) {
+    char* path = realpath(file, nullptr);
+    if (!path) {
+      std::cerr << "Could not open file \"" << file << "\"" << std::endl;
+      return EXIT_FAILURE;
+    }
+    const int status = Server::request(socket, Server::PATH, path, std::cout, std::cerr);
+    free(path);
+    return status < 0 ? EXIT_FAILURE : status;
   }
-  init_scanner(input_file);
-  yydebug = 0;  /* Change to 1 if you want debugging */
+  std::string text((std::istreambuf_iterator<char>(std::cin)), std::istreambuf_iterator<char>());
+  const int status = Server::request(socket, Server::TEXT, text, std::cout, std::cerr);
+  return status < 0 ? EXIT_FAILURE : status;
+}
 
-  try {
-    if ( yyparse() == 0 ) {
-      fclose(input_file);
-      end_scanner();
-      PoolOfNodes::getInstance().add(NullNode::getInstance());
-      PoolOfNodes::getInstance().drainThePool();
-      std::cout << "Program syntactically correct" << std::endl;
-      return EXIT_SUCCESS;
+// runs each script on a thread of its own, at most jobs at a time: its
+// interpreter goes with the thread. Output is kept per script and
+// written in the order the scripts were given.
+static int run_jobs(const std::vector<const char*>& files, unsigned long jobs,
+                    const Interpreter::Options& options) {
+  std::vector<std::string> outputs(files.size());
+  std::vector<int> statuses(files.size(), -1);
+  std::atomic<unsigned long> next(0);
+  std::mutex finished;
+  unsigned long written = 0;
+  int status = EXIT_SUCCESS;
+  auto work = [&]() {
+    for (unsigned long i = next++; i < files.size(); i = next++) {
+      std::ostringstream out;
+      int result = EXIT_FAILURE;
+      std::thread([&]() {
+        Interpreter& interpreter = Interpreter::getInstance();
+        interpreter.configure(options);
+        interpreter.setOutput(out);
+        result = interpreter.run(files[i]);
+        PoolOfNodes::getInstance().drainThePool();
+      }).join();
+      std::lock_guard<std::mutex> lock(finished);
+      outputs[i] = out.str();
+      statuses[i] = result;
+      for (; written < files.size() && statuses[written] >= 0; ++written) {
+        std::cout << outputs[written];
+        std::string().swap(outputs[written]);
+        if (statuses[written] != EXIT_SUCCESS) status = EXIT_FAILURE;
+      }
+      std::cout.flush();
     }
+  };
+  std::vector<std::thread> workers;
+  for (unsigned long j = 0; j < jobs && j < files.size(); ++j) {
+    workers.emplace_back(work);
   }
-  catch ( const std::string& msg ) {
-    std::cout << msg << std::endl;
-    return EXIT_FAILURE;
-  }
-  catch ( ... ) {
-    std::cout << "Uncaught exception: " << std::endl;
+  for (std::thread& worker : workers) {
+    worker.join();
   }
+  return status;
 }
 
+int main(int argc, char * argv[]) {
+  Interpreter::Options options;
+  bool memStats = false;
+  bool gcStats = false;
+  bool cacheStats = false;
+  bool dumpQuick = false;
+  bool jitStats = false;
+  // 0: no profile, otherwise the sampling interval in microseconds, or 1 for none
+  unsigned long profile = 0;
+  const char* stacksFile = nullptr;
+  // 0: run the one script on this thread
+  unsigned long jobs = 0;
+  const char* serveSocket = nullptr;
+  const char* connectSocket = nullptr;
+  std::vector<const char*> files;
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg(argv[i]);
+    if (arg == "--engine=ast") {
+      options.vm = false;
+    }
+    else if (arg == "--engine=vm") {
+      options.vm = true;
+    }
+    else if (arg == "--mem-stats") {
+      memStats = true;
+    }
+    else if (arg == "--gc-stats") {
+      gcStats = true;
+    }
+    else if (arg == "--cache-stats") {
+      cacheStats = true;
+    }
+    else if (arg == "--dump-ast") {
+      // the dump is made while parsing, so never run from the cache
+      options.dumpAst = true;
+    }
+    else if (arg == "--dump-quick") {
+      dumpQuick = true;
+    }
+    else if (arg == "--jit=off") {
+      options.jitThreshold = -1;
+    }
+    else if (arg == "--jit=on") {
+      options.jitThreshold = Jit::defaultThreshold;
+    }
+    else if (arg.compare(0, 16, "--jit=threshold=") == 0) {
+      char* end = nullptr;
+      long calls = strtol(arg.c_str() + 16, &end, 10);
+      if (*end || calls < 0) usage(argv[0]);
+      options.jitThreshold = calls;
+    }
+    else if (arg == "--jit-stats") {
+      jitStats = true;
+    }
+    else if (arg == "--profile") {
+      if (!profile) profile = 1;
+    }
+    else if (arg == "--profile=lines") {
+      profile = sampleInterval;
+    }
+    else if (arg.compare(0, 17, "--profile-stacks=") == 0) {
+      if (arg.size() == 17) usage(argv[0]);
+      profile = sampleInterval;
+      stacksFile = argv[i] + 17;
+    }
+    else if (arg == "--no-mmap") {
+      // read the file in, as for a pipe
+      options.mapInput = false;
+    }
+    else if (arg == "--line-buffered") {
+      // a line at a time on a terminal, rather than a buffer at a time
+      options.lineBuffered = true;
+    }
+    else if (arg == "--no-cache") {
+      options.useCache = false;
+    }
+    else if (arg == "--memoize") {
+      options.memoEntries = 1 << 16;
+    }
+    else if (arg.compare(0, 10, "--memoize=") == 0) {
+      char* end = nullptr;
+      long entries = strtol(arg.c_str() + 10, &end, 10);
+      if (*end || entries <= 0) usage(argv[0]);
+      options.memoEntries = entries;
+    }
+    else if (arg.compare(0, 9, "--warmup=") == 0) {
+      char* end = nullptr;
+      long n = strtol(arg.c_str() + 9, &end, 10);
+      if (*end || n < 0) usage(argv[0]);
+      options.warmup = n;
+    }
+    else if (arg.compare(0, 15, "--gc-threshold=") == 0) {
+      char* end = nullptr;
+      long bytes = strtol(arg.c_str() + 15, &end, 10);
+      if (*end || bytes <= 0) usage(argv[0]);
+      options.gcThreshold = bytes;
+    }
+    else if (arg.compare(0, 18, "--recursion-limit=") == 0) {
+      char* end = nullptr;
+      long limit = strtol(arg.c_str() + 18, &end, 10);
+      if (*end || limit <= 0) usage(argv[0]);
+      options.recursionLimit = limit;
+    }
+    else if (arg.compare(0, 7, "--jobs=") == 0) {
+      char* end = nullptr;
+      long n = strtol(arg.c_str() + 7, &end, 10);
+      if (*end || n <= 0) usage(argv[0]);
+      jobs = n;
+    }
+    else if (arg == "--serve" && i + 1 < argc) {
+      serveSocket = argv[++i];
+    }
+    else if (arg == "--connect" && i + 1 < argc) {
+      connectSocket = argv[++i];
+    }
+    else if (arg.compare(0, 1, "-") == 0) {
+      usage(argv[0]);
+    }
+    else { /* user-supplied filename */
+      files.push_back(argv[i]);
+    }
+  }
+  yydebug = 0;  /* Change to 1 if you want debugging */
+  const bool stats = memStats || gcStats || cacheStats || dumpQuick || jitStats || profile;
+  if (serveSocket) {
+    // the scripts come from the socket, each on an interpreter of its own
+    if (connectSocket || !files.empty() || stats) usage(argv[0]);
+    Server server(serveSocket, jobs ? jobs : std::thread::hardware_concurrency(), options);
+    return server.serve();
+  }
+  if (connectSocket) {
+    if (files.size() > 1 || jobs || stats) usage(argv[0]);
+    return run_remote(connectSocket, files.empty() ? nullptr : files[0]);
+  }
+  if (jobs) {
+    // the statistics and the profile are those of one interpreter
+    if (files.empty() || stats) usage(argv[0]);
+    return run_jobs(files, jobs, options);
+  }
+  if (files.size() > 1) usage(argv[0]);
+
+  Interpreter& interpreter = Interpreter::getInstance();
+  interpreter.configure(options);
+  Profiler& profiler = Profiler::getInstance();
+#ifdef MYPY_NO_PROFILER
+  if (profile) {
+    std::cerr << "profile: this build has no profiler (MYPY_NO_PROFILER)" << std::endl;
+    profile = 0;
+  }
+#endif
+  if (profile) profiler.start(profile == 1 ? 0 : profile);
+  const int status = interpreter.run(files.empty() ? nullptr : files[0]);
+  if (memStats) printMemStats();
+  if (gcStats) Heap::getInstance().printStats(std::cerr);
+  if (cacheStats) TableManager::getInstance().printCacheStats(std::cerr);
+  if (Memo::getInstance().isEnabled()) Memo::getInstance().printStats(std::cerr);
+  if (dumpQuick) Quickening::getInstance().dump(std::cerr);
+  if (jitStats) Jit::getInstance().printStats(std::cerr);
+  if (profile) {
+    profiler.stop();
+    profiler.report(std::cerr);
+    if (stacksFile) {
+      std::ofstream out(stacksFile);
+      profiler.writeStacks(out);
+      if (!out) std::cerr << "profile: cannot write " << stacksFile << std::endl;
+    }
+  }
+  PoolOfNodes::getInstance().drainThePool();
+  return status;
+}
@@ -0,0 +1,3258 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 2
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 7 "includes/parse.y"
+
+#include "includes/ast.h"
+#include "includes/bigint.h"
+#include "includes/constants.h"
+#include "includes/folder.h"
+#include "includes/programCache.h"
+#include "includes/gc.h"
+#include "includes/interpreter.h"
+#include "includes/profiler.h"
+
+#line 82 "parse.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "parse.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_INT = 3,                        /* INT  */
+  YYSYMBOL_FLOAT = 4,                      /* FLOAT  */
+  YYSYMBOL_NAME = 5,                       /* NAME  */
+  YYSYMBOL_STRING = 6,                     /* STRING  */
+  YYSYMBOL_LONGINT = 7,                    /* LONGINT  */
+  YYSYMBOL_AMPEREQUAL = 8,                 /* AMPEREQUAL  */
+  YYSYMBOL_AMPERSAND = 9,                  /* AMPERSAND  */
+  YYSYMBOL_AND = 10,                       /* AND  */
+  YYSYMBOL_AS = 11,                        /* AS  */
+  YYSYMBOL_ASSERT = 12,                    /* ASSERT  */
+  YYSYMBOL_AT = 13,                        /* AT  */
+  YYSYMBOL_BACKQUOTE = 14,                 /* BACKQUOTE  */
+  YYSYMBOL_BAR = 15,                       /* BAR  */
+  YYSYMBOL_BREAK = 16,                     /* BREAK  */
+  YYSYMBOL_CIRCUMFLEX = 17,                /* CIRCUMFLEX  */
+  YYSYMBOL_CIRCUMFLEXEQUAL = 18,           /* CIRCUMFLEXEQUAL  */
+  YYSYMBOL_CLASS = 19,                     /* CLASS  */
+  YYSYMBOL_COLON = 20,                     /* COLON  */
+  YYSYMBOL_COMMA = 21,                     /* COMMA  */
+  YYSYMBOL_CONTINUE = 22,                  /* CONTINUE  */
+  YYSYMBOL_DEDENT = 23,                    /* DEDENT  */
+  YYSYMBOL_DEF = 24,                       /* DEF  */
+  YYSYMBOL_DEL = 25,                       /* DEL  */
+  YYSYMBOL_DOT = 26,                       /* DOT  */
+  YYSYMBOL_DOUBLESLASH = 27,               /* DOUBLESLASH  */
+  YYSYMBOL_DOUBLESLASHEQUAL = 28,          /* DOUBLESLASHEQUAL  */
+  YYSYMBOL_DOUBLESTAR = 29,                /* DOUBLESTAR  */
+  YYSYMBOL_DOUBLESTAREQUAL = 30,           /* DOUBLESTAREQUAL  */
+  YYSYMBOL_ELIF = 31,                      /* ELIF  */
+  YYSYMBOL_ELSE = 32,                      /* ELSE  */
+  YYSYMBOL_ENDMARKER = 33,                 /* ENDMARKER  */
+  YYSYMBOL_EQEQUAL = 34,                   /* EQEQUAL  */
+  YYSYMBOL_EQUAL = 35,                     /* EQUAL  */
+  YYSYMBOL_EXCEPT = 36,                    /* EXCEPT  */
+  YYSYMBOL_EXEC = 37,                      /* EXEC  */
+  YYSYMBOL_FINALLY = 38,                   /* FINALLY  */
+  YYSYMBOL_FOR = 39,                       /* FOR  */
+  YYSYMBOL_FROM = 40,                      /* FROM  */
+  YYSYMBOL_GLOBAL = 41,                    /* GLOBAL  */
+  YYSYMBOL_GREATER = 42,                   /* GREATER  */
+  YYSYMBOL_GREATEREQUAL = 43,              /* GREATEREQUAL  */
+  YYSYMBOL_GRLT = 44,                      /* GRLT  */
+  YYSYMBOL_IF = 45,                        /* IF  */
+  YYSYMBOL_IMPORT = 46,                    /* IMPORT  */
+  YYSYMBOL_IN = 47,                        /* IN  */
+  YYSYMBOL_INDENT = 48,                    /* INDENT  */
+  YYSYMBOL_IS = 49,                        /* IS  */
+  YYSYMBOL_LAMBDA = 50,                    /* LAMBDA  */
+  YYSYMBOL_LBRACE = 51,                    /* LBRACE  */
+  YYSYMBOL_LEFTSHIFT = 52,                 /* LEFTSHIFT  */
+  YYSYMBOL_LEFTSHIFTEQUAL = 53,            /* LEFTSHIFTEQUAL  */
+  YYSYMBOL_LESS = 54,                      /* LESS  */
+  YYSYMBOL_LESSEQUAL = 55,                 /* LESSEQUAL  */
+  YYSYMBOL_LPAR = 56,                      /* LPAR  */
+  YYSYMBOL_LSQB = 57,                      /* LSQB  */
+  YYSYMBOL_MINEQUAL = 58,                  /* MINEQUAL  */
+  YYSYMBOL_MINUS = 59,                     /* MINUS  */
+  YYSYMBOL_NEWLINE = 60,                   /* NEWLINE  */
+  YYSYMBOL_NOT = 61,                       /* NOT  */
+  YYSYMBOL_NOTEQUAL = 62,                  /* NOTEQUAL  */
+  YYSYMBOL_NUMBER = 63,                    /* NUMBER  */
+  YYSYMBOL_OR = 64,                        /* OR  */
+  YYSYMBOL_PASS = 65,                      /* PASS  */
+  YYSYMBOL_PERCENT = 66,                   /* PERCENT  */
+  YYSYMBOL_PERCENTEQUAL = 67,              /* PERCENTEQUAL  */
+  YYSYMBOL_PLUS = 68,                      /* PLUS  */
+  YYSYMBOL_PLUSEQUAL = 69,                 /* PLUSEQUAL  */
+  YYSYMBOL_PRINT = 70,                     /* PRINT  */
+  YYSYMBOL_RAISE = 71,                     /* RAISE  */
+  YYSYMBOL_RBRACE = 72,                    /* RBRACE  */
+  YYSYMBOL_RETURN = 73,                    /* RETURN  */
+  YYSYMBOL_RIGHTSHIFT = 74,                /* RIGHTSHIFT  */
+  YYSYMBOL_RIGHTSHIFTEQUAL = 75,           /* RIGHTSHIFTEQUAL  */
+  YYSYMBOL_RPAR = 76,                      /* RPAR  */
+  YYSYMBOL_RSQB = 77,                      /* RSQB  */
+  YYSYMBOL_SEMI = 78,                      /* SEMI  */
+  YYSYMBOL_SLASH = 79,                     /* SLASH  */
+  YYSYMBOL_SLASHEQUAL = 80,                /* SLASHEQUAL  */
+  YYSYMBOL_STAR = 81,                      /* STAR  */
+  YYSYMBOL_STAREQUAL = 82,                 /* STAREQUAL  */
+  YYSYMBOL_TILDE = 83,                     /* TILDE  */
+  YYSYMBOL_TRY = 84,                       /* TRY  */
+  YYSYMBOL_VBAREQUAL = 85,                 /* VBAREQUAL  */
+  YYSYMBOL_WHILE = 86,                     /* WHILE  */
+  YYSYMBOL_WITH = 87,                      /* WITH  */
+  YYSYMBOL_YIELD = 88,                     /* YIELD  */
+  YYSYMBOL_YYACCEPT = 89,                  /* $accept  */
+  YYSYMBOL_start = 90,                     /* start  */
+  YYSYMBOL_file_input = 91,                /* file_input  */
+  YYSYMBOL_pick_NEWLINE_stmt = 92,         /* pick_NEWLINE_stmt  */
+  YYSYMBOL_star_NEWLINE_stmt = 93,         /* star_NEWLINE_stmt  */
+  YYSYMBOL_decorator = 94,                 /* decorator  */
+  YYSYMBOL_opt_arglist = 95,               /* opt_arglist  */
+  YYSYMBOL_decorators = 96,                /* decorators  */
+  YYSYMBOL_decorated = 97,                 /* decorated  */
+  YYSYMBOL_funcdef = 98,                   /* funcdef  */
+  YYSYMBOL_parameters = 99,                /* parameters  */
+  YYSYMBOL_varargslist = 100,              /* varargslist  */
+  YYSYMBOL_opt_EQUAL_test = 101,           /* opt_EQUAL_test  */
+  YYSYMBOL_star_fpdef_COMMA = 102,         /* star_fpdef_COMMA  */
+  YYSYMBOL_opt_DOUBLESTAR_NAME = 103,      /* opt_DOUBLESTAR_NAME  */
+  YYSYMBOL_pick_STAR_DOUBLESTAR = 104,     /* pick_STAR_DOUBLESTAR  */
+  YYSYMBOL_opt_COMMA = 105,                /* opt_COMMA  */
+  YYSYMBOL_fpdef = 106,                    /* fpdef  */
+  YYSYMBOL_fplist = 107,                   /* fplist  */
+  YYSYMBOL_star_fpdef_notest = 108,        /* star_fpdef_notest  */
+  YYSYMBOL_stmt = 109,                     /* stmt  */
+  YYSYMBOL_simple_stmt = 110,              /* simple_stmt  */
+  YYSYMBOL_star_SEMI_small_stmt = 111,     /* star_SEMI_small_stmt  */
+  YYSYMBOL_small_stmt = 112,               /* small_stmt  */
+  YYSYMBOL_expr_stmt = 113,                /* expr_stmt  */
+  YYSYMBOL_pick_yield_expr_testlist = 114, /* pick_yield_expr_testlist  */
+  YYSYMBOL_star_EQUAL = 115,               /* star_EQUAL  */
+  YYSYMBOL_augassign = 116,                /* augassign  */
+  YYSYMBOL_print_stmt = 117,               /* print_stmt  */
+  YYSYMBOL_star_COMMA_test = 118,          /* star_COMMA_test  */
+  YYSYMBOL_opt_test = 119,                 /* opt_test  */
+  YYSYMBOL_plus_COMMA_test = 120,          /* plus_COMMA_test  */
+  YYSYMBOL_opt_test_2 = 121,               /* opt_test_2  */
+  YYSYMBOL_del_stmt = 122,                 /* del_stmt  */
+  YYSYMBOL_pass_stmt = 123,                /* pass_stmt  */
+  YYSYMBOL_flow_stmt = 124,                /* flow_stmt  */
+  YYSYMBOL_break_stmt = 125,               /* break_stmt  */
+  YYSYMBOL_continue_stmt = 126,            /* continue_stmt  */
+  YYSYMBOL_return_stmt = 127,              /* return_stmt  */
+  YYSYMBOL_yield_stmt = 128,               /* yield_stmt  */
+  YYSYMBOL_raise_stmt = 129,               /* raise_stmt  */
+  YYSYMBOL_opt_COMMA_test = 130,           /* opt_COMMA_test  */
+  YYSYMBOL_opt_test_3 = 131,               /* opt_test_3  */
+  YYSYMBOL_import_stmt = 132,              /* import_stmt  */
+  YYSYMBOL_import_name = 133,              /* import_name  */
+  YYSYMBOL_import_from = 134,              /* import_from  */
+  YYSYMBOL_pick_dotted_name = 135,         /* pick_dotted_name  */
+  YYSYMBOL_pick_STAR_import = 136,         /* pick_STAR_import  */
+  YYSYMBOL_import_as_name = 137,           /* import_as_name  */
+  YYSYMBOL_dotted_as_name = 138,           /* dotted_as_name  */
+  YYSYMBOL_import_as_names = 139,          /* import_as_names  */
+  YYSYMBOL_star_COMMA_import_as_name = 140, /* star_COMMA_import_as_name  */
+  YYSYMBOL_dotted_as_names = 141,          /* dotted_as_names  */
+  YYSYMBOL_dotted_name = 142,              /* dotted_name  */
+  YYSYMBOL_global_stmt = 143,              /* global_stmt  */
+  YYSYMBOL_star_COMMA_NAME = 144,          /* star_COMMA_NAME  */
+  YYSYMBOL_exec_stmt = 145,                /* exec_stmt  */
+  YYSYMBOL_assert_stmt = 146,              /* assert_stmt  */
+  YYSYMBOL_compound_stmt = 147,            /* compound_stmt  */
+  YYSYMBOL_if_stmt = 148,                  /* if_stmt  */
+  YYSYMBOL_star_ELIF = 149,                /* star_ELIF  */
+  YYSYMBOL_while_stmt = 150,               /* while_stmt  */
+  YYSYMBOL_for_stmt = 151,                 /* for_stmt  */
+  YYSYMBOL_try_stmt = 152,                 /* try_stmt  */
+  YYSYMBOL_plus_except = 153,              /* plus_except  */
+  YYSYMBOL_opt_ELSE = 154,                 /* opt_ELSE  */
+  YYSYMBOL_opt_FINALLY = 155,              /* opt_FINALLY  */
+  YYSYMBOL_with_stmt = 156,                /* with_stmt  */
+  YYSYMBOL_star_COMMA_with_item = 157,     /* star_COMMA_with_item  */
+  YYSYMBOL_with_item = 158,                /* with_item  */
+  YYSYMBOL_except_clause = 159,            /* except_clause  */
+  YYSYMBOL_pick_AS_COMMA = 160,            /* pick_AS_COMMA  */
+  YYSYMBOL_opt_AS_COMMA = 161,             /* opt_AS_COMMA  */
+  YYSYMBOL_suite = 162,                    /* suite  */
+  YYSYMBOL_plus_stmt = 163,                /* plus_stmt  */
+  YYSYMBOL_testlist_safe = 164,            /* testlist_safe  */
+  YYSYMBOL_plus_COMMA_old_test = 165,      /* plus_COMMA_old_test  */
+  YYSYMBOL_old_test = 166,                 /* old_test  */
+  YYSYMBOL_old_lambdef = 167,              /* old_lambdef  */
+  YYSYMBOL_test = 168,                     /* test  */
+  YYSYMBOL_opt_IF_ELSE = 169,              /* opt_IF_ELSE  */
+  YYSYMBOL_or_test = 170,                  /* or_test  */
+  YYSYMBOL_and_test = 171,                 /* and_test  */
+  YYSYMBOL_not_test = 172,                 /* not_test  */
+  YYSYMBOL_comparison = 173,               /* comparison  */
+  YYSYMBOL_comp_op = 174,                  /* comp_op  */
+  YYSYMBOL_expr = 175,                     /* expr  */
+  YYSYMBOL_xor_expr = 176,                 /* xor_expr  */
+  YYSYMBOL_and_expr = 177,                 /* and_expr  */
+  YYSYMBOL_shift_expr = 178,               /* shift_expr  */
+  YYSYMBOL_pick_LEFTSHIFT_RIGHTSHIFT = 179, /* pick_LEFTSHIFT_RIGHTSHIFT  */
+  YYSYMBOL_arith_expr = 180,               /* arith_expr  */
+  YYSYMBOL_pick_PLUS_MINUS = 181,          /* pick_PLUS_MINUS  */
+  YYSYMBOL_term = 182,                     /* term  */
+  YYSYMBOL_pick_multop = 183,              /* pick_multop  */
+  YYSYMBOL_factor = 184,                   /* factor  */
+  YYSYMBOL_pick_unop = 185,                /* pick_unop  */
+  YYSYMBOL_power = 186,                    /* power  */
+  YYSYMBOL_star_trailer = 187,             /* star_trailer  */
+  YYSYMBOL_atom = 188,                     /* atom  */
+  YYSYMBOL_pick_yield_expr_testlist_comp = 189, /* pick_yield_expr_testlist_comp  */
+  YYSYMBOL_opt_yield_test = 190,           /* opt_yield_test  */
+  YYSYMBOL_opt_listmaker = 191,            /* opt_listmaker  */
+  YYSYMBOL_opt_dictorsetmaker = 192,       /* opt_dictorsetmaker  */
+  YYSYMBOL_plus_STRING = 193,              /* plus_STRING  */
+  YYSYMBOL_listmaker = 194,                /* listmaker  */
+  YYSYMBOL_testlist_comp = 195,            /* testlist_comp  */
+  YYSYMBOL_lambdef = 196,                  /* lambdef  */
+  YYSYMBOL_trailer = 197,                  /* trailer  */
+  YYSYMBOL_subscriptlist = 198,            /* subscriptlist  */
+  YYSYMBOL_star_COMMA_subscript = 199,     /* star_COMMA_subscript  */
+  YYSYMBOL_subscript = 200,                /* subscript  */
+  YYSYMBOL_opt_test_only = 201,            /* opt_test_only  */
+  YYSYMBOL_opt_sliceop = 202,              /* opt_sliceop  */
+  YYSYMBOL_sliceop = 203,                  /* sliceop  */
+  YYSYMBOL_exprlist = 204,                 /* exprlist  */
+  YYSYMBOL_star_COMMA_expr = 205,          /* star_COMMA_expr  */
+  YYSYMBOL_testlist = 206,                 /* testlist  */
+  YYSYMBOL_dictorsetmaker = 207,           /* dictorsetmaker  */
+  YYSYMBOL_star_test_COLON_test = 208,     /* star_test_COLON_test  */
+  YYSYMBOL_pick_for_test_test = 209,       /* pick_for_test_test  */
+  YYSYMBOL_pick_for_test = 210,            /* pick_for_test  */
+  YYSYMBOL_classdef = 211,                 /* classdef  */
+  YYSYMBOL_opt_testlist = 212,             /* opt_testlist  */
+  YYSYMBOL_arglist = 213,                  /* arglist  */
+  YYSYMBOL_star_argument_COMMA = 214,      /* star_argument_COMMA  */
+  YYSYMBOL_star_COMMA_argument = 215,      /* star_COMMA_argument  */
+  YYSYMBOL_opt_DOUBLESTAR_test = 216,      /* opt_DOUBLESTAR_test  */
+  YYSYMBOL_pick_argument = 217,            /* pick_argument  */
+  YYSYMBOL_argument = 218,                 /* argument  */
+  YYSYMBOL_opt_comp_for = 219,             /* opt_comp_for  */
+  YYSYMBOL_list_iter = 220,                /* list_iter  */
+  YYSYMBOL_list_for = 221,                 /* list_for  */
+  YYSYMBOL_list_if = 222,                  /* list_if  */
+  YYSYMBOL_comp_iter = 223,                /* comp_iter  */
+  YYSYMBOL_comp_for = 224,                 /* comp_for  */
+  YYSYMBOL_comp_if = 225,                  /* comp_if  */
+  YYSYMBOL_testlist1 = 226,                /* testlist1  */
+  YYSYMBOL_yield_expr = 227,               /* yield_expr  */
+  YYSYMBOL_star_DOT = 228                  /* star_DOT  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+/* Unqualified %code blocks.  */
+#line 18 "includes/parse.y"
+
+int yylex (YYSTYPE*, YYLTYPE*, yyscan_t);
+char* yyget_text(yyscan_t);
+void yyerror (YYLTYPE*, yyscan_t, ParseContext&, const char *);
+
+bool isOpEqual(const char*, const char*);
+void appendString(std::string&, const TokenView&);
+
+#line 354 "parse.tab.c"
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL \
+             && defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+  YYLTYPE yyls_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE) \
+             + YYSIZEOF (YYLTYPE)) \
+      + 2 * YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  4
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   989
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  89
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  140
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  316
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  480
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   343
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,    81,    81,    84,    87,    90,    99,   100,   103,   104,
+     107,   108,   111,   112,   115,   116,   119,   128,   129,   132,
+     136,   149,   150,   153,   165,   168,   169,   172,   173,   176,
+     177,   180,   183,   186,   195,   206,   215,   218,   224,   232,
+     233,   236,   237,   240,   241,   242,   243,   244,   245,   246,
+     247,   248,   251,   275,   284,   285,   288,   295,   298,   299,
+     300,   301,   302,   303,   304,   305,   306,   307,   308,   309,
+     312,   315,   320,   321,   324,   325,   328,   329,   332,   333,
+     336,   339,   342,   343,   344,   345,   346,   349,   352,   355,
+     358,   363,   366,   367,   370,   371,   374,   375,   378,   379,
+     382,   385,   388,   389,   392,   393,   394,   397,   398,   401,
+     402,   405,   406,   409,   410,   413,   414,   417,   418,   421,
+     424,   425,   428,   429,   432,   433,   436,   437,   438,   439,
+     440,   441,   442,   443,   446,   449,   454,   455,   458,   459,
+     462,   463,   466,   467,   470,   471,   474,   475,   478,   479,
+     482,   485,   486,   489,   490,   493,   494,   497,   498,   501,
+     502,   505,   510,   513,   517,   523,   524,   527,   528,   531,
+     532,   535,   536,   539,   540,   543,   544,   547,   548,   551,
+     552,   555,   556,   559,   560,   575,   576,   577,   578,   579,
+     580,   581,   582,   583,   584,   585,   588,   589,   592,   593,
+     596,   597,   600,   601,   604,   605,   608,   609,   619,   620,
+     623,   624,   644,   645,   646,   647,   650,   651,   654,   655,
+     656,   659,   662,   673,   678,   684,   685,   686,   687,   688,
+     691,   692,   695,   698,   701,   710,   711,   714,   715,   718,
+     719,   722,   723,   726,   736,   745,   746,   749,   750,   753,
+     754,   757,   764,   765,   768,   769,   772,   773,   776,   777,
+     778,   781,   782,   785,   786,   789,   790,   793,   794,   797,
+     798,   801,   802,   805,   806,   809,   810,   813,   814,   817,
+     818,   821,   822,   825,   826,   829,   845,   854,   857,   858,
+     861,   862,   865,   866,   870,   876,   877,   882,   883,   886,
+     887,   890,   891,   894,   895,   898,   899,   902,   903,   906,
+     907,   910,   911,   914,   915,   918,   919
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "INT", "FLOAT", "NAME",
+  "STRING", "LONGINT", "AMPEREQUAL", "AMPERSAND", "AND", "AS", "ASSERT",
+  "AT", "BACKQUOTE", "BAR", "BREAK", "CIRCUMFLEX", "CIRCUMFLEXEQUAL",
+  "CLASS", "COLON", "COMMA", "CONTINUE", "DEDENT", "DEF", "DEL", "DOT",
+  "DOUBLESLASH", "DOUBLESLASHEQUAL", "DOUBLESTAR", "DOUBLESTAREQUAL",
+  "ELIF", "ELSE", "ENDMARKER", "EQEQUAL", "EQUAL", "EXCEPT", "EXEC",
+  "FINALLY", "FOR", "FROM", "GLOBAL", "GREATER", "GREATEREQUAL", "GRLT",
+  "IF", "IMPORT", "IN", "INDENT", "IS", "LAMBDA", "LBRACE", "LEFTSHIFT",
+  "LEFTSHIFTEQUAL", "LESS", "LESSEQUAL", "LPAR", "LSQB", "MINEQUAL",
+  "MINUS", "NEWLINE", "NOT", "NOTEQUAL", "NUMBER", "OR", "PASS", "PERCENT",
+  "PERCENTEQUAL", "PLUS", "PLUSEQUAL", "PRINT", "RAISE", "RBRACE",
+  "RETURN", "RIGHTSHIFT", "RIGHTSHIFTEQUAL", "RPAR", "RSQB", "SEMI",
+  "SLASH", "SLASHEQUAL", "STAR", "STAREQUAL", "TILDE", "TRY", "VBAREQUAL",
+  "WHILE", "WITH", "YIELD", "$accept", "start", "file_input",
+  "pick_NEWLINE_stmt", "star_NEWLINE_stmt", "decorator", "opt_arglist",
+  "decorators", "decorated", "funcdef", "parameters", "varargslist",
+  "opt_EQUAL_test", "star_fpdef_COMMA", "opt_DOUBLESTAR_NAME",
+  "pick_STAR_DOUBLESTAR", "opt_COMMA", "fpdef", "fplist",
+  "star_fpdef_notest", "stmt", "simple_stmt", "star_SEMI_small_stmt",
+  "small_stmt", "expr_stmt", "pick_yield_expr_testlist", "star_EQUAL",
+  "augassign", "print_stmt", "star_COMMA_test", "opt_test",
+  "plus_COMMA_test", "opt_test_2", "del_stmt", "pass_stmt", "flow_stmt",
+  "break_stmt", "continue_stmt", "return_stmt", "yield_stmt", "raise_stmt",
+  "opt_COMMA_test", "opt_test_3", "import_stmt", "import_name",
+  "import_from", "pick_dotted_name", "pick_STAR_import", "import_as_name",
+  "dotted_as_name", "import_as_names", "star_COMMA_import_as_name",
+  "dotted_as_names", "dotted_name", "global_stmt", "star_COMMA_NAME",
+  "exec_stmt", "assert_stmt", "compound_stmt", "if_stmt", "star_ELIF",
+  "while_stmt", "for_stmt", "try_stmt", "plus_except", "opt_ELSE",
+  "opt_FINALLY", "with_stmt", "star_COMMA_with_item", "with_item",
+  "except_clause", "pick_AS_COMMA", "opt_AS_COMMA", "suite", "plus_stmt",
+  "testlist_safe", "plus_COMMA_old_test", "old_test", "old_lambdef",
+  "test", "opt_IF_ELSE", "or_test", "and_test", "not_test", "comparison",
+  "comp_op", "expr", "xor_expr", "and_expr", "shift_expr",
+  "pick_LEFTSHIFT_RIGHTSHIFT", "arith_expr", "pick_PLUS_MINUS", "term",
+  "pick_multop", "factor", "pick_unop", "power", "star_trailer", "atom",
+  "pick_yield_expr_testlist_comp", "opt_yield_test", "opt_listmaker",
+  "opt_dictorsetmaker", "plus_STRING", "listmaker", "testlist_comp",
+  "lambdef", "trailer", "subscriptlist", "star_COMMA_subscript",
+  "subscript", "opt_test_only", "opt_sliceop", "sliceop", "exprlist",
+  "star_COMMA_expr", "testlist", "dictorsetmaker", "star_test_COLON_test",
+  "pick_for_test_test", "pick_for_test", "classdef", "opt_testlist",
+  "arglist", "star_argument_COMMA", "star_COMMA_argument",
+  "opt_DOUBLESTAR_test", "pick_argument", "argument", "opt_comp_for",
+  "list_iter", "list_for", "list_if", "comp_iter", "comp_for", "comp_if",
+  "testlist1", "yield_expr", "star_DOT", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-287)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-263)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+    -287,    48,  -287,   335,  -287,  -287,  -287,  -287,  -287,  -287,
+     845,    54,   845,  -287,    88,  -287,    97,    82,  -287,    82,
+      82,  -287,   100,   845,    54,    59,   845,    47,   845,  -287,
+    -287,   886,  -287,  -287,  -287,   763,   845,   845,  -287,   148,
+     845,   845,   845,  -287,  -287,   113,  -287,  -287,  -287,  -287,
+    -287,  -287,  -287,  -287,  -287,  -287,  -287,  -287,  -287,  -287,
+    -287,  -287,  -287,  -287,  -287,  -287,  -287,  -287,  -287,  -287,
+    -287,  -287,  -287,  -287,    -1,   121,  -287,   199,   137,   154,
+     166,   -18,    12,    55,  -287,    82,  -287,  -287,   171,  -287,
+     904,  -287,  -287,   158,  -287,    16,  -287,   132,    13,   130,
+     137,  -287,    23,   143,   147,    32,  -287,   177,  -287,   180,
+      51,   845,   184,    18,    53,   135,  -287,   169,  -287,   133,
+    -287,  -287,   173,   139,  -287,  -287,   845,  -287,  -287,   189,
+    -287,   596,   195,  -287,   206,  -287,  -287,  -287,  -287,   -21,
+     197,   886,   886,  -287,   886,  -287,  -287,  -287,  -287,  -287,
+     161,  -287,  -287,   176,  -287,    82,    82,    82,    82,  -287,
+    -287,    82,  -287,  -287,    82,  -287,  -287,  -287,  -287,    82,
+    -287,    99,  -287,  -287,  -287,  -287,  -287,    47,  -287,  -287,
+    -287,  -287,  -287,  -287,  -287,  -287,  -287,    47,   845,   220,
+     152,  -287,  -287,   845,   596,   845,   156,   210,   213,   845,
+     845,    38,   190,   209,   217,   596,    54,   234,  -287,   845,
+    -287,   239,    35,   240,  -287,   214,   845,    82,   229,  -287,
+    -287,  -287,   229,  -287,  -287,    82,   229,  -287,  -287,   231,
+     229,   845,  -287,   207,  -287,   111,   596,   138,    82,  -287,
+     669,   845,    17,   121,  -287,  -287,  -287,   137,   154,   166,
+     -18,    12,    55,  -287,   251,    82,   152,   779,  -287,   224,
+    -287,  -287,  -287,  -287,  -287,   186,  -287,    61,  -287,  -287,
+    -287,   188,  -287,   193,   596,    82,   244,   246,   259,   266,
+    -287,  -287,  -287,  -287,   267,  -287,  -287,  -287,  -287,  -287,
+    -287,   198,   252,   845,   254,   169,   230,   845,  -287,  -287,
+     232,  -287,   845,   255,  -287,  -287,   244,   510,   845,   258,
+     125,   260,   249,   596,   845,   137,  -287,  -287,  -287,   845,
+    -287,  -287,   208,   256,   265,   211,  -287,   269,  -287,   226,
+     845,   845,   131,  -287,   270,   273,  -287,  -287,   137,   845,
+    -287,   596,   285,   218,   274,  -287,   153,   276,  -287,   272,
+    -287,  -287,     7,  -287,   278,  -287,  -287,   886,   870,  -287,
+     845,  -287,  -287,  -287,   424,    34,   596,   283,   275,   287,
+     596,   288,  -287,  -287,  -287,  -287,   284,  -287,   290,   845,
+    -287,  -287,  -287,   845,  -287,  -287,   236,  -287,   596,  -287,
+     282,  -287,  -287,   266,   845,   295,    35,   311,   845,  -287,
+      -4,   297,    68,   298,  -287,   262,  -287,  -287,  -287,  -287,
+    -287,   845,  -287,  -287,   596,   302,  -287,   596,  -287,   596,
+    -287,   697,  -287,   303,   306,  -287,  -287,   304,  -287,   310,
+     596,  -287,  -287,   312,   870,  -287,  -287,  -287,   870,   313,
+     870,  -287,  -287,  -287,   870,   314,  -287,  -287,   596,  -287,
+    -287,  -287,   845,  -287,  -287,   804,  -287,   596,   596,  -287,
+     845,   109,  -287,   870,    68,  -287,   870,  -287,  -287,  -287,
+     845,  -287,  -287,  -287,  -287,  -287,  -287,  -287,  -287,  -287
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+       7,     0,     2,     0,     1,   231,   233,   229,   244,   232,
+       0,     0,     0,    87,     0,    88,     0,     0,     3,     0,
+       0,   316,     0,     0,     0,    24,   242,   238,   240,   219,
+       4,     0,   230,    81,   218,    75,    93,    90,   220,     0,
+       0,     0,   314,     6,    13,     0,   133,   131,     5,    37,
+      42,    43,    44,    45,    46,    47,    82,    83,    84,    86,
+      85,    48,    98,    99,    49,    50,    51,    38,   126,   127,
+     128,   129,   130,    73,   176,   177,   179,   182,   183,   196,
+     198,   200,   202,   206,   210,     0,   217,   224,   234,   174,
+      57,   132,    91,   125,   117,     0,   311,     0,     0,     0,
+     270,    80,   123,     0,     0,     0,   121,     0,   115,   100,
+     110,     0,     0,     0,    73,     0,   241,    73,   237,     0,
+     236,   235,    73,     0,   239,   181,     0,    70,    73,    97,
+      89,     0,     0,   152,   154,   313,    12,    15,    14,     0,
+     272,     0,     0,   173,     0,   187,   186,   188,   190,   192,
+     194,   185,   189,     0,   191,     0,     0,     0,     0,   204,
+     205,     0,   209,   208,     0,   215,   214,   213,   212,     0,
+     216,   222,   243,    63,    65,    69,    68,     0,    66,    59,
+      62,    58,    67,    61,    60,    64,    53,     0,     0,     0,
+     287,     9,   228,     0,     0,   284,    24,     0,   268,     0,
+       0,     0,   315,   102,   119,     0,     0,     0,   250,     0,
+      31,     0,     0,     0,    19,    22,     0,     0,    30,   274,
+     279,   227,    30,   247,   225,     0,    30,   245,   226,    79,
+      30,     0,    92,     0,   161,     0,     0,     0,     0,    40,
+       0,   271,     0,   178,   180,   195,   193,   184,   197,   199,
+     201,   203,   207,   211,     0,     0,   287,   262,   223,    57,
+      55,    54,    52,   124,   118,     0,    10,     0,   312,   282,
+     283,     0,    18,     0,     0,   267,    95,     0,   108,     0,
+     104,   101,   114,   106,     0,   137,   116,   109,   249,    28,
+      36,     0,    26,     0,    30,   276,     0,    29,   280,   248,
+       0,   246,     0,    30,    71,    74,    95,     0,   156,     0,
+     147,     0,   139,     0,     0,   153,    39,    41,    72,     0,
+     253,   221,     0,     0,   259,     0,   257,     0,    56,     0,
+       0,     0,   298,   285,    30,     0,    17,    16,   269,     0,
+     122,     0,     0,     0,   112,   120,   135,    34,    32,     0,
+      27,    21,    23,    20,    30,   273,   277,     0,     0,    77,
+      29,    78,    96,   164,     0,   160,     0,     0,   149,     0,
+       0,     0,   150,   151,   175,   251,     0,   252,   255,   262,
+       8,   294,   289,     0,   295,   297,   286,   292,     0,    94,
+     141,   107,   105,   111,     0,     0,    33,     0,    29,   278,
+     308,    24,   302,   166,   170,   169,    76,   162,   163,   157,
+     158,     0,   155,   143,     0,     0,   142,     0,   145,     0,
+     258,   254,   261,   264,   291,   296,   281,     0,   113,     0,
+       0,    35,    25,     0,     0,   307,   305,   306,     0,     0,
+       0,   301,   299,   300,     0,    30,   159,   146,     0,   144,
+     138,   256,   266,   260,   263,     0,   293,     0,     0,   134,
+       0,   310,   172,     0,   304,   168,    29,   165,   148,   265,
+       0,   288,   140,   136,   275,   309,   171,   303,   167,   290
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -287,  -287,  -287,  -287,  -287,   286,    62,  -287,  -287,   289,
+    -287,  -187,  -287,  -287,  -287,  -287,  -194,  -202,  -287,  -287,
+    -286,    -2,  -287,    96,  -287,   150,    84,  -287,  -287,    74,
+    -287,  -287,  -287,  -287,  -287,  -287,  -287,  -287,  -287,  -287,
+    -287,    39,  -287,  -287,  -287,  -287,  -287,  -287,   -49,   140,
+      73,  -287,  -287,     9,  -287,  -287,  -287,  -287,  -287,  -287,
+    -287,  -287,  -287,  -287,  -287,  -287,  -287,  -287,  -287,    41,
+      43,  -287,  -287,  -190,  -287,  -287,  -287,  -271,  -287,   -10,
+    -287,  -138,   216,   -17,  -287,  -287,   -12,   200,   204,   205,
+    -287,   203,  -287,   201,  -287,   -74,  -287,  -287,  -287,  -287,
+    -287,  -287,  -287,  -287,  -287,  -287,  -287,  -287,  -287,  -287,
+    -287,   -55,    -9,  -287,  -287,   -14,  -287,   -13,  -287,  -287,
+    -287,  -287,   322,  -287,  -287,  -287,  -287,  -287,  -287,   -84,
+    -287,   -87,   257,  -287,   -83,   -95,  -287,  -287,   -15,  -287
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,     1,     2,    43,     3,    44,   265,    45,    46,    47,
+     197,   112,   294,   113,   350,   214,   298,   215,   291,   347,
+      48,   234,   139,    50,    51,   259,   186,   187,    52,   140,
+     127,   303,   304,    53,    54,    55,    56,    57,    58,    59,
+      60,   340,   232,    61,    62,    63,   104,   281,   282,   108,
+     283,   344,   109,   110,    64,   204,    65,    66,    67,    68,
+     346,    69,    70,    71,   310,   368,   416,    72,   237,   133,
+     311,   411,   412,   235,   364,   402,   445,   403,   404,    73,
+     143,    74,    75,    76,    77,   155,    78,    79,    80,    81,
+     161,    82,   164,    83,   169,    84,    85,    86,   171,    87,
+     118,   119,   123,   115,    88,   124,   120,    89,   258,   325,
+     378,   326,   327,   453,   454,   101,   198,    90,   116,   354,
+     355,   219,    91,   271,   266,   267,   424,   456,   333,   334,
+     384,   441,   442,   443,   435,   436,   437,    97,    92,   105
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      93,    49,    96,   242,   269,   100,   103,   102,   100,   273,
+     290,   170,   121,   107,   125,   285,   114,   117,   122,   220,
+      95,   363,   223,   210,   130,   128,   129,   -29,   299,   135,
+     132,   134,   301,   194,   159,   217,   305,    94,   156,   239,
+     210,   434,   189,   278,   141,   409,   312,   211,     4,   319,
+       5,     6,     7,     8,     9,   410,   160,   240,   202,    94,
+     142,    12,   207,   142,     5,     6,     7,     8,     9,   195,
+     199,   162,   190,   216,   212,    12,   191,   189,   408,   111,
+     163,   142,   165,   -29,   337,     5,     6,     7,     8,     9,
+     330,   212,   217,    98,   279,   253,    12,    25,    26,   213,
+     353,   208,    99,    27,    28,   106,    29,   225,    31,   361,
+      32,    25,    26,   440,   203,    34,   229,    27,    28,   280,
+      29,   166,    31,   372,    32,   254,    11,   244,   255,    34,
+      38,   144,    14,    26,   167,    42,   168,    16,    27,    28,
+     387,    29,   331,   247,    38,    32,   192,   308,   217,   309,
+      34,   390,   156,   193,   434,   256,   257,   367,   313,   314,
+     399,   308,   261,   461,   260,    38,   383,   462,   131,   464,
+     217,   157,   261,   465,   260,   158,   413,   172,   263,   188,
+     418,   321,   270,   268,   394,   395,   196,   277,   218,   276,
+     200,   222,   476,   201,   431,   478,   226,   205,   426,   288,
+     356,   206,   230,   296,   209,   100,   295,   221,   217,   224,
+     231,   300,   225,   100,   439,   236,   228,   238,   241,   400,
+     405,   306,   245,   246,   447,   264,   315,   449,   -11,   450,
+     274,   318,   272,   145,   275,   189,  -103,   385,   284,   287,
+     459,   146,   147,   148,   289,   292,   149,   324,   150,   293,
+     297,   467,   302,   151,   152,   307,   320,   332,   468,   177,
+     153,   154,   329,   338,   335,   339,   341,   472,   473,   336,
+     342,   278,   345,   349,   348,   352,   360,   357,   366,   358,
+     370,   371,   376,   351,   375,  -261,   380,   318,   377,   379,
+     391,   386,   359,   388,   392,   393,   405,   396,   365,   398,
+     405,   397,   405,   414,   134,    49,   405,   417,   419,   374,
+     420,   421,   -29,   415,   427,   430,   432,   438,   322,   444,
+     381,   382,   448,   452,   457,   405,   142,   455,   405,   389,
+     458,   136,   460,   463,   137,   466,   317,   262,     5,     6,
+       7,     8,     9,   328,   428,   362,   286,    10,    11,    12,
+     406,    13,   343,   369,    14,   373,   248,    15,   243,    16,
+      17,   249,    49,   250,   251,   252,   451,   138,    18,   422,
+     423,   471,    19,   425,    20,    21,    22,   477,   475,   227,
+      23,    24,     0,     0,   429,    25,    26,     0,   433,     0,
+       0,    27,    28,     0,    29,    30,    31,     0,    32,     0,
+      33,   446,     0,    34,     0,    35,    36,     0,    37,     0,
+       0,   324,     0,     0,     0,     0,     0,     0,    38,    39,
+       0,    40,    41,    42,     0,     0,     0,     5,     6,     7,
+       8,     9,     0,     0,     0,     0,    10,    11,    12,     0,
+      13,     0,   469,    14,     0,   332,    15,   407,    16,    17,
+     474,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     479,    19,     0,    20,    21,    22,     0,     0,     0,    23,
+      24,     0,     0,     0,    25,    26,     0,     0,     0,     0,
+      27,    28,     0,    29,     0,    31,     0,    32,     0,    33,
+       0,     0,    34,     0,    35,    36,     0,    37,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    38,    39,     0,
+      40,    41,    42,     5,     6,     7,     8,     9,     0,     0,
+       0,     0,    10,    11,    12,     0,    13,     0,     0,    14,
+       0,     0,    15,     0,    16,    17,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    19,     0,    20,
+      21,    22,     0,     0,     0,    23,    24,     0,     0,     0,
+      25,    26,     0,     0,     0,     0,    27,    28,     0,    29,
+       0,    31,     0,    32,     0,    33,     0,     0,    34,     0,
+      35,    36,     0,    37,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    38,    39,     0,    40,    41,    42,     5,
+       6,     7,     8,     9,     0,     0,     0,     0,    10,     0,
+      12,     0,    13,     0,     0,     0,     0,     0,    15,     0,
+       0,    17,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    19,     0,     0,    21,    22,     0,     0,
+       0,     0,    24,     0,     0,     0,    25,    26,     0,     0,
+       0,     0,    27,    28,     0,    29,   233,    31,     0,    32,
+       0,    33,     0,     0,    34,     0,    35,    36,     0,    37,
+       0,     0,     5,     6,     7,     8,     9,     0,     0,    38,
+       0,    10,     0,    12,    42,    13,     0,     0,     0,     0,
+       0,    15,     0,     0,    17,     0,     0,     0,     0,     0,
+       5,     6,     7,     8,     9,     0,    19,     0,     0,    21,
+      22,    12,     0,     0,     0,    24,     0,  -262,     0,    25,
+      26,     0,     0,   323,     0,    27,    28,     0,    29,   316,
+      31,     0,    32,     0,    33,     0,     0,    34,     0,    35,
+      36,     0,    37,     0,     0,     0,     0,    25,    26,     0,
+       0,     0,    38,    27,    28,     0,    29,    42,    31,     0,
+      32,     0,     0,     0,     0,    34,     5,     6,     7,     8,
+       9,     0,     0,     0,     0,     0,     0,    12,     0,     0,
+      38,     0,     5,     6,     7,     8,     9,     0,     0,     0,
+       0,     0,     0,    12,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   323,     0,     5,     6,     7,
+       8,     9,     0,    25,    26,     0,     0,     0,    12,    27,
+      28,     0,    29,     0,    31,     0,    32,     0,     0,    25,
+      26,    34,     0,   470,     0,    27,    28,   126,    29,     0,
+      31,     0,    32,     0,     0,     0,    38,    34,     5,     6,
+       7,     8,     9,     0,    25,    26,     0,     0,     0,    12,
+      27,    28,    38,    29,     0,    31,     0,    32,     0,     0,
+       0,     0,    34,     5,     6,     7,     8,     9,     0,     0,
+       0,     0,     0,     0,    12,     0,     0,    38,     0,     5,
+       6,     7,     8,     9,     0,    25,    26,     0,     0,     0,
+      12,    27,    28,     0,    29,     0,    31,     0,    32,     0,
+       0,     0,   173,    34,     0,     0,     0,     0,     0,     0,
+     401,    26,   174,     0,     0,     0,    27,    28,    38,    29,
+       0,    31,   175,    32,   176,     0,     0,    26,    34,   177,
+       0,     0,    27,    28,     0,    29,     0,    31,     0,    32,
+       0,     0,     0,    38,    34,     0,     0,   178,     0,     0,
+       0,     0,   179,     0,     0,     0,     0,     0,     0,    38,
+       0,   180,     0,   181,     0,     0,     0,     0,     0,   182,
+       0,     0,     0,     0,   183,     0,   184,     0,     0,   185
+};
+
+static const yytype_int16 yycheck[] =
+{
+      10,     3,    12,   141,   194,    17,    20,    19,    20,   196,
+     212,    85,    27,    23,    31,   205,    26,    27,    28,   114,
+      11,   307,   117,     5,    37,    35,    36,    20,   222,    42,
+      40,    41,   226,    20,    52,    39,   230,     5,    15,    60,
+       5,    45,    26,     5,    45,    11,   236,    29,     0,    32,
+       3,     4,     5,     6,     7,    21,    74,    78,    26,     5,
+      64,    14,    11,    64,     3,     4,     5,     6,     7,    56,
+      47,    59,    56,    20,    56,    14,    60,    26,   364,    20,
+      68,    64,    27,    76,   274,     3,     4,     5,     6,     7,
+      29,    56,    39,     5,    56,   169,    14,    50,    51,    81,
+     294,   111,     5,    56,    57,     5,    59,    39,    61,   303,
+      63,    50,    51,    45,   105,    68,   126,    56,    57,    81,
+      59,    66,    61,   313,    63,    26,    13,   144,    29,    68,
+      83,    10,    19,    51,    79,    88,    81,    24,    56,    57,
+     334,    59,    81,   155,    83,    63,    14,    36,    39,    38,
+      68,   341,    15,    21,    45,    56,    57,    32,    20,    21,
+     354,    36,   177,   434,   177,    83,    35,   438,    20,   440,
+      39,    17,   187,   444,   187,     9,   366,     6,   188,    21,
+     370,   255,   195,   193,    31,    32,    56,   200,   114,   199,
+      47,   117,   463,    46,   396,   466,   122,    20,   388,   209,
+     295,    21,   128,   217,    20,   217,   216,    72,    39,    76,
+      21,   225,    39,   225,   401,    20,    77,    11,    21,   357,
+     358,   231,    61,    47,   414,     5,   238,   417,    76,   419,
+      20,   241,    76,    34,    21,    26,    46,   332,    21,     5,
+     430,    42,    43,    44,     5,     5,    47,   257,    49,    35,
+      21,   445,    21,    54,    55,    48,     5,   267,   448,    35,
+      61,    62,    76,   275,    76,    21,    20,   457,   458,    76,
+      11,     5,     5,    21,    76,    21,    21,    47,    20,    47,
+      20,    32,    26,   293,    76,    20,    60,   297,    77,    20,
+       5,    21,   302,    20,    76,    21,   434,    21,   308,    21,
+     438,    29,   440,    20,   314,   307,   444,    20,    20,   319,
+      26,    21,    76,    38,    32,    20,     5,    20,   256,    21,
+     330,   331,    20,    20,    20,   463,    64,    21,   466,   339,
+      20,    45,    20,    20,    45,    21,   240,   187,     3,     4,
+       5,     6,     7,   259,   393,   306,   206,    12,    13,    14,
+     360,    16,   279,   310,    19,   314,   156,    22,   142,    24,
+      25,   157,   364,   158,   161,   164,   421,    45,    33,   379,
+     379,   455,    37,   383,    39,    40,    41,   464,   461,   122,
+      45,    46,    -1,    -1,   394,    50,    51,    -1,   398,    -1,
+      -1,    56,    57,    -1,    59,    60,    61,    -1,    63,    -1,
+      65,   411,    -1,    68,    -1,    70,    71,    -1,    73,    -1,
+      -1,   421,    -1,    -1,    -1,    -1,    -1,    -1,    83,    84,
+      -1,    86,    87,    88,    -1,    -1,    -1,     3,     4,     5,
+       6,     7,    -1,    -1,    -1,    -1,    12,    13,    14,    -1,
+      16,    -1,   452,    19,    -1,   455,    22,    23,    24,    25,
+     460,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     470,    37,    -1,    39,    40,    41,    -1,    -1,    -1,    45,
+      46,    -1,    -1,    -1,    50,    51,    -1,    -1,    -1,    -1,
+      56,    57,    -1,    59,    -1,    61,    -1,    63,    -1,    65,
+      -1,    -1,    68,    -1,    70,    71,    -1,    73,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    83,    84,    -1,
+      86,    87,    88,     3,     4,     5,     6,     7,    -1,    -1,
+      -1,    -1,    12,    13,    14,    -1,    16,    -1,    -1,    19,
+      -1,    -1,    22,    -1,    24,    25,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    37,    -1,    39,
+      40,    41,    -1,    -1,    -1,    45,    46,    -1,    -1,    -1,
+      50,    51,    -1,    -1,    -1,    -1,    56,    57,    -1,    59,
+      -1,    61,    -1,    63,    -1,    65,    -1,    -1,    68,    -1,
+      70,    71,    -1,    73,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    83,    84,    -1,    86,    87,    88,     3,
+       4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,    -1,
+      14,    -1,    16,    -1,    -1,    -1,    -1,    -1,    22,    -1,
+      -1,    25,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    37,    -1,    -1,    40,    41,    -1,    -1,
+      -1,    -1,    46,    -1,    -1,    -1,    50,    51,    -1,    -1,
+      -1,    -1,    56,    57,    -1,    59,    60,    61,    -1,    63,
+      -1,    65,    -1,    -1,    68,    -1,    70,    71,    -1,    73,
+      -1,    -1,     3,     4,     5,     6,     7,    -1,    -1,    83,
+      -1,    12,    -1,    14,    88,    16,    -1,    -1,    -1,    -1,
+      -1,    22,    -1,    -1,    25,    -1,    -1,    -1,    -1,    -1,
+       3,     4,     5,     6,     7,    -1,    37,    -1,    -1,    40,
+      41,    14,    -1,    -1,    -1,    46,    -1,    20,    -1,    50,
+      51,    -1,    -1,    26,    -1,    56,    57,    -1,    59,    60,
+      61,    -1,    63,    -1,    65,    -1,    -1,    68,    -1,    70,
+      71,    -1,    73,    -1,    -1,    -1,    -1,    50,    51,    -1,
+      -1,    -1,    83,    56,    57,    -1,    59,    88,    61,    -1,
+      63,    -1,    -1,    -1,    -1,    68,     3,     4,     5,     6,
+       7,    -1,    -1,    -1,    -1,    -1,    -1,    14,    -1,    -1,
+      83,    -1,     3,     4,     5,     6,     7,    -1,    -1,    -1,
+      -1,    -1,    -1,    14,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    26,    -1,     3,     4,     5,
+       6,     7,    -1,    50,    51,    -1,    -1,    -1,    14,    56,
+      57,    -1,    59,    -1,    61,    -1,    63,    -1,    -1,    50,
+      51,    68,    -1,    29,    -1,    56,    57,    74,    59,    -1,
+      61,    -1,    63,    -1,    -1,    -1,    83,    68,     3,     4,
+       5,     6,     7,    -1,    50,    51,    -1,    -1,    -1,    14,
+      56,    57,    83,    59,    -1,    61,    -1,    63,    -1,    -1,
+      -1,    -1,    68,     3,     4,     5,     6,     7,    -1,    -1,
+      -1,    -1,    -1,    -1,    14,    -1,    -1,    83,    -1,     3,
+       4,     5,     6,     7,    -1,    50,    51,    -1,    -1,    -1,
+      14,    56,    57,    -1,    59,    -1,    61,    -1,    63,    -1,
+      -1,    -1,     8,    68,    -1,    -1,    -1,    -1,    -1,    -1,
+      50,    51,    18,    -1,    -1,    -1,    56,    57,    83,    59,
+      -1,    61,    28,    63,    30,    -1,    -1,    51,    68,    35,
+      -1,    -1,    56,    57,    -1,    59,    -1,    61,    -1,    63,
+      -1,    -1,    -1,    83,    68,    -1,    -1,    53,    -1,    -1,
+      -1,    -1,    58,    -1,    -1,    -1,    -1,    -1,    -1,    83,
+      -1,    67,    -1,    69,    -1,    -1,    -1,    -1,    -1,    75,
+      -1,    -1,    -1,    -1,    80,    -1,    82,    -1,    -1,    85
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_uint8 yystos[] =
+{
+       0,    90,    91,    93,     0,     3,     4,     5,     6,     7,
+      12,    13,    14,    16,    19,    22,    24,    25,    33,    37,
+      39,    40,    41,    45,    46,    50,    51,    56,    57,    59,
+      60,    61,    63,    65,    68,    70,    71,    73,    83,    84,
+      86,    87,    88,    92,    94,    96,    97,    98,   109,   110,
+     112,   113,   117,   122,   123,   124,   125,   126,   127,   128,
+     129,   132,   133,   134,   143,   145,   146,   147,   148,   150,
+     151,   152,   156,   168,   170,   171,   172,   173,   175,   176,
+     177,   178,   180,   182,   184,   185,   186,   188,   193,   196,
+     206,   211,   227,   168,     5,   142,   168,   226,     5,     5,
+     175,   204,   175,   204,   135,   228,     5,   168,   138,   141,
+     142,    20,   100,   102,   168,   192,   207,   168,   189,   190,
+     195,   227,   168,   191,   194,   172,    74,   119,   168,   168,
+     206,    20,   168,   158,   168,   206,    94,    98,   211,   111,
+     118,    45,    64,   169,    10,    34,    42,    43,    44,    47,
+      49,    54,    55,    61,    62,   174,    15,    17,     9,    52,
+      74,   179,    59,    68,   181,    27,    66,    79,    81,   183,
+     184,   187,     6,     8,    18,    28,    30,    35,    53,    58,
+      67,    69,    75,    80,    82,    85,   115,   116,    21,    26,
+      56,    60,    14,    21,    20,    56,    56,    99,   205,    47,
+      47,    46,    26,   142,   144,    20,    21,    11,   168,    20,
+       5,    29,    56,    81,   104,   106,    20,    39,   118,   210,
+     224,    72,   118,   224,    76,    39,   118,   221,    77,   168,
+     118,    21,   131,    60,   110,   162,    20,   157,    11,    60,
+      78,    21,   170,   171,   172,    61,    47,   175,   176,   177,
+     178,   180,   182,   184,    26,    29,    56,    57,   197,   114,
+     206,   227,   114,   168,     5,    95,   213,   214,   168,   162,
+     206,   212,    76,   100,    20,    21,   168,   206,     5,    56,
+      81,   136,   137,   139,    21,   162,   138,     5,   168,     5,
+     106,   107,     5,    35,   101,   168,   204,    21,   105,   105,
+     204,   105,    21,   120,   121,   105,   168,    48,    36,    38,
+     153,   159,   162,    20,    21,   175,    60,   112,   168,    32,
+       5,   184,    95,    26,   168,   198,   200,   201,   115,    76,
+      29,    81,   168,   217,   218,    76,    76,   162,   175,    21,
+     130,    20,    11,   139,   140,     5,   149,   108,    76,    21,
+     103,   168,    21,   105,   208,   209,   224,    47,    47,   168,
+      21,   105,   130,   109,   163,   168,    20,    32,   154,   159,
+      20,    32,   162,   158,   168,    76,    26,    77,   199,    20,
+      60,   168,   168,    35,   219,   224,    21,   105,    20,   168,
+     162,     5,    76,    21,    31,    32,    21,    29,    21,   105,
+     170,    50,   164,   166,   167,   170,   168,    23,   109,    11,
+      21,   160,   161,   162,    20,    38,   155,    20,   162,    20,
+      26,    21,   168,   201,   215,   168,   162,    32,   137,   168,
+      20,   106,     5,   168,    45,   223,   224,   225,    20,   100,
+      45,   220,   221,   222,    21,   165,   168,   162,    20,   162,
+     162,   200,    20,   202,   203,    21,   216,    20,    20,   162,
+      20,   166,   166,    20,   166,   166,    21,   105,   162,   168,
+      29,   218,   162,   162,   168,   223,   166,   220,   166,   168
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_uint8 yyr1[] =
+{
+       0,    89,    90,    91,    92,    92,    93,    93,    94,    94,
+      95,    95,    96,    96,    97,    97,    98,    99,    99,   100,
+     100,   101,   101,   102,   102,   103,   103,   104,   104,   105,
+     105,   106,   106,   107,   107,   108,   108,   109,   109,   110,
+     110,   111,   111,   112,   112,   112,   112,   112,   112,   112,
+     112,   112,   113,   113,   114,   114,   115,   115,   116,   116,
+     116,   116,   116,   116,   116,   116,   116,   116,   116,   116,
+     117,   117,   118,   118,   119,   119,   120,   120,   121,   121,
+     122,   123,   124,   124,   124,   124,   124,   125,   126,   127,
+     127,   128,   129,   129,   130,   130,   131,   131,   132,   132,
+     133,   134,   135,   135,   136,   136,   136,   137,   137,   138,
+     138,   139,   139,   140,   140,   141,   141,   142,   142,   143,
+     144,   144,   145,   145,   146,   146,   147,   147,   147,   147,
+     147,   147,   147,   147,   148,   148,   149,   149,   150,   150,
+     151,   151,   152,   152,   153,   153,   154,   154,   155,   155,
+     156,   157,   157,   158,   158,   159,   159,   160,   160,   161,
+     161,   162,   162,   163,   163,   164,   164,   165,   165,   166,
+     166,   167,   167,   168,   168,   169,   169,   170,   170,   171,
+     171,   172,   172,   173,   173,   174,   174,   174,   174,   174,
+     174,   174,   174,   174,   174,   174,   175,   175,   176,   176,
+     177,   177,   178,   178,   179,   179,   180,   180,   181,   181,
+     182,   182,   183,   183,   183,   183,   184,   184,   185,   185,
+     185,   186,   186,   187,   187,   188,   188,   188,   188,   188,
+     188,   188,   188,   188,   188,   189,   189,   190,   190,   191,
+     191,   192,   192,   193,   193,   194,   194,   195,   195,   196,
+     196,   197,   197,   197,   198,   198,   199,   199,   200,   200,
+     200,   201,   201,   202,   202,   203,   203,   204,   204,   205,
+     205,   206,   206,   207,   207,   208,   208,   209,   209,   210,
+     210,   211,   211,   212,   212,   213,   214,   214,   215,   215,
+     216,   216,   217,   217,   217,   218,   218,   219,   219,   220,
+     220,   221,   221,   222,   222,   223,   223,   224,   224,   225,
+     225,   226,   226,   227,   227,   228,   228
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     2,     1,     1,     2,     0,     6,     3,
+       1,     0,     2,     1,     2,     2,     5,     3,     2,     2,
+       4,     2,     0,     4,     0,     3,     0,     3,     2,     1,
+       0,     1,     3,     3,     2,     3,     0,     1,     1,     4,
+       3,     3,     0,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     3,     2,     1,     1,     3,     0,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       2,     4,     3,     0,     3,     0,     3,     2,     2,     0,
+       2,     1,     1,     1,     1,     1,     1,     1,     1,     2,
+       1,     1,     3,     1,     2,     0,     3,     0,     1,     1,
+       2,     4,     2,     2,     1,     3,     1,     3,     1,     3,
+       1,     3,     2,     3,     0,     1,     3,     1,     3,     3,
+       3,     0,     5,     2,     4,     2,     1,     1,     1,     1,
+       1,     1,     1,     1,     8,     5,     5,     0,     7,     4,
+       9,     6,     6,     6,     4,     3,     3,     0,     3,     0,
+       5,     3,     0,     3,     1,     3,     1,     1,     1,     2,
+       0,     1,     4,     2,     1,     3,     1,     3,     2,     1,
+       1,     4,     3,     2,     1,     4,     0,     1,     3,     1,
+       3,     2,     1,     1,     3,     1,     1,     1,     1,     1,
+       1,     1,     1,     2,     1,     2,     1,     3,     1,     3,
+       1,     3,     1,     3,     1,     1,     1,     3,     1,     1,
+       1,     3,     1,     1,     1,     1,     2,     1,     1,     1,
+       1,     4,     2,     2,     0,     3,     3,     3,     3,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     0,     1,
+       0,     1,     0,     2,     1,     2,     3,     2,     3,     4,
+       3,     3,     3,     2,     3,     2,     3,     0,     3,     1,
+       4,     1,     0,     1,     0,     2,     1,     3,     2,     3,
+       0,     3,     2,     4,     2,     5,     0,     1,     2,     1,
+       2,     7,     4,     1,     0,     2,     3,     0,     3,     0,
+       3,     0,     2,     4,     2,     2,     3,     1,     0,     1,
+       1,     5,     4,     3,     2,     1,     1,     5,     4,     3,
+       2,     1,     3,     2,     1,     2,     0
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (&yylloc, scanner, context, YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
+   If N is 0, then set CURRENT to the empty location which ends
+   the previous symbol: RHS[0] (always defined).  */
+
+#ifndef YYLLOC_DEFAULT
+# define YYLLOC_DEFAULT(Current, Rhs, N)                                \
+    do                                                                  \
+      if (N)                                                            \
+        {                                                               \
+          (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;        \
+          (Current).first_column = YYRHSLOC (Rhs, 1).first_column;      \
+          (Current).last_line    = YYRHSLOC (Rhs, N).last_line;         \
+          (Current).last_column  = YYRHSLOC (Rhs, N).last_column;       \
+        }                                                               \
+      else                                                              \
+        {                                                               \
+          (Current).first_line   = (Current).last_line   =              \
+            YYRHSLOC (Rhs, 0).last_line;                                \
+          (Current).first_column = (Current).last_column =              \
+            YYRHSLOC (Rhs, 0).last_column;                              \
+        }                                                               \
+    while (0)
+#endif
+
+#define YYRHSLOC(Rhs, K) ((Rhs)[K])
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+/* YYLOCATION_PRINT -- Print the location on the stream.
+   This macro was not mandated originally: define only if we know
+   we won't break user code: when these are the locations we know.  */
+
+# ifndef YYLOCATION_PRINT
+
+#  if defined YY_LOCATION_PRINT
+
+   /* Temporary convenience wrapper in case some people defined the
+      undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YYLOCATION_PRINT(File, Loc)  YY_LOCATION_PRINT(File, *(Loc))
+
+#  elif defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+
+/* Print *YYLOCP on YYO.  Private, do not rely on its existence. */
+
+YY_ATTRIBUTE_UNUSED
+static int
+yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
+{
+  int res = 0;
+  int end_col = 0 != yylocp->last_column ? yylocp->last_column - 1 : 0;
+  if (0 <= yylocp->first_line)
+    {
+      res += YYFPRINTF (yyo, "%d", yylocp->first_line);
+      if (0 <= yylocp->first_column)
+        res += YYFPRINTF (yyo, ".%d", yylocp->first_column);
+    }
+  if (0 <= yylocp->last_line)
+    {
+      if (yylocp->first_line < yylocp->last_line)
+        {
+          res += YYFPRINTF (yyo, "-%d", yylocp->last_line);
+          if (0 <= end_col)
+            res += YYFPRINTF (yyo, ".%d", end_col);
+        }
+      else if (0 <= end_col && yylocp->first_column < end_col)
+        res += YYFPRINTF (yyo, "-%d", end_col);
+    }
+  return res;
+}
+
+#   define YYLOCATION_PRINT  yy_location_print_
+
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT(File, Loc)  YYLOCATION_PRINT(File, &(Loc))
+
+#  else
+
+#   define YYLOCATION_PRINT(File, Loc) ((void) 0)
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT  YYLOCATION_PRINT
+
+#  endif
+# endif /* !defined YYLOCATION_PRINT */
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, Location, scanner, context); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, yyscan_t scanner, ParseContext& context)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (yylocationp);
+  YY_USE (scanner);
+  YY_USE (context);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, yyscan_t scanner, ParseContext& context)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  YYLOCATION_PRINT (yyo, yylocationp);
+  YYFPRINTF (yyo, ": ");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, yylocationp, scanner, context);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp,
+                 int yyrule, yyscan_t scanner, ParseContext& context)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)],
+                       &(yylsp[(yyi + 1) - (yynrhs)]), scanner, context);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, yylsp, Rule, scanner, context); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, YYLTYPE *yylocationp, yyscan_t scanner, ParseContext& context)
+{
+  YY_USE (yyvaluep);
+  YY_USE (yylocationp);
+  YY_USE (scanner);
+  YY_USE (context);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (yyscan_t scanner, ParseContext& context)
+{
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
+
+/* Location data for the lookahead symbol.  */
+static YYLTYPE yyloc_default
+# if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+  = { 1, 1, 1, 1 }
+# endif
+;
+YYLTYPE yylloc = yyloc_default;
+
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
+
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+    /* The location stack: array, bottom, top.  */
+    YYLTYPE yylsa[YYINITDEPTH];
+    YYLTYPE *yyls = yylsa;
+    YYLTYPE *yylsp = yyls;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+  YYLTYPE yyloc;
+
+  /* The locations where the error started and ended.  */
+  YYLTYPE yyerror_range[3];
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N), yylsp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  yylsp[0] = yylloc;
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+        YYLTYPE *yyls1 = yyls;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yyls1, yysize * YYSIZEOF (*yylsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+        yyls = yyls1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+        YYSTACK_RELOCATE (yyls_alloc, yyls);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+      yylsp = yyls + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex (&yylval, &yylloc, scanner);
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      yyerror_range[1] = yylloc;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+  *++yylsp = yylloc;
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+  /* Default location. */
+  YYLLOC_DEFAULT (yyloc, (yylsp - yylen), yylen);
+  yyerror_range[1] = yyloc;
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 4: /* pick_NEWLINE_stmt: NEWLINE  */
+#line 87 "includes/parse.y"
+                  {
+		(yyval.node) = context.pool.make<PrintNode>(nullptr);
+	}
+#line 1933 "parse.tab.c"
+    break;
+
+  case 5: /* pick_NEWLINE_stmt: stmt  */
+#line 90 "includes/parse.y"
+               {
+		if ((yyvsp[0].node)) {
+			(yyvsp[0].node) = Folder::getInstance().fold((yyvsp[0].node));
+			ProgramCache::getInstance().record((yyvsp[0].node));
+			context.stmts.push_back((yyvsp[0].node));
+		}
+	}
+#line 1945 "parse.tab.c"
+    break;
+
+  case 10: /* opt_arglist: arglist  */
+#line 107 "includes/parse.y"
+                  { (yyval.node) = (yyvsp[0].node); }
+#line 1951 "parse.tab.c"
+    break;
+
+  case 11: /* opt_arglist: %empty  */
+#line 108 "includes/parse.y"
+                 { (yyval.node) = nullptr; }
+#line 1957 "parse.tab.c"
+    break;
+
+  case 16: /* funcdef: DEF NAME parameters COLON suite  */
+#line 119 "includes/parse.y"
+                                          {
+		if ((yyvsp[0].node) == nullptr) {
+			(yyval.node) = nullptr;
+		} else {
+			(yyval.node) = context.pool.make<FuncNode>((yyvsp[-3].atom), (yyvsp[-2].node), (yyvsp[0].node));
+		}
+	}
+#line 1969 "parse.tab.c"
+    break;
+
+  case 17: /* parameters: LPAR varargslist RPAR  */
+#line 128 "includes/parse.y"
+                                { (yyval.node) = (yyvsp[-1].node); }
+#line 1975 "parse.tab.c"
+    break;
+
+  case 18: /* parameters: LPAR RPAR  */
+#line 129 "includes/parse.y"
+                    { (yyval.node) = nullptr; }
+#line 1981 "parse.tab.c"
+    break;
+
+  case 19: /* varargslist: star_fpdef_COMMA pick_STAR_DOUBLESTAR  */
+#line 132 "includes/parse.y"
+                                                {
+		// TODO: *args, **kwargs
+		(yyval.node) = (yyvsp[-1].node);
+	}
+#line 1990 "parse.tab.c"
+    break;
+
+  case 20: /* varargslist: star_fpdef_COMMA fpdef opt_EQUAL_test opt_COMMA  */
+#line 136 "includes/parse.y"
+                                                          {
+		// TODO: $4 -> (foo = xxx) -> default value
+		if ((yyvsp[-3].node)) {
+			reinterpret_cast<ParamNode*>((yyvsp[-3].node))->append((yyvsp[-2].node));
+			(yyval.node) = (yyvsp[-3].node);
+		} else {
+			// only one positional parameter
+			(yyval.node) = context.pool.make<ParamNode>();
+			reinterpret_cast<ParamNode*>((yyval.node))->append((yyvsp[-2].node));
+		}
+	}
+#line 2006 "parse.tab.c"
+    break;
+
+  case 21: /* opt_EQUAL_test: EQUAL test  */
+#line 149 "includes/parse.y"
+                     { (yyval.node) = (yyvsp[0].node); }
+#line 2012 "parse.tab.c"
+    break;
+
+  case 22: /* opt_EQUAL_test: %empty  */
+#line 150 "includes/parse.y"
+                 { (yyval.node) = nullptr; }
+#line 2018 "parse.tab.c"
+    break;
+
+  case 23: /* star_fpdef_COMMA: star_fpdef_COMMA fpdef opt_EQUAL_test COMMA  */
+#line 153 "includes/parse.y"
+                                                      {
+		if ((yyvsp[-1].node)) {
+			(yyvsp[-2].node) = context.pool.make<AsgBinaryNode>((yyvsp[-2].node), (yyvsp[-1].node));
+		}
+		if ((yyvsp[-3].node)) {
+			reinterpret_cast<ParamNode*>((yyvsp[-3].node))->append((yyvsp[-2].node));
+			(yyval.node) = (yyvsp[-3].node);
+		} else {
+			(yyval.node) = context.pool.make<ParamNode>();
+			reinterpret_cast<ParamNode*>((yyval.node))->append((yyvsp[-2].node));
+		}
+	}
+#line 2035 "parse.tab.c"
+    break;
+
+  case 24: /* star_fpdef_COMMA: %empty  */
+#line 165 "includes/parse.y"
+                 { (yyval.node) = nullptr; }
+#line 2041 "parse.tab.c"
+    break;
+
+  case 31: /* fpdef: NAME  */
+#line 180 "includes/parse.y"
+               {
+		(yyval.node) = context.pool.make<IdentNode>((yyvsp[0].atom));
+	}
+#line 2049 "parse.tab.c"
+    break;
+
+  case 32: /* fpdef: LPAR fplist RPAR  */
+#line 183 "includes/parse.y"
+                           { (yyval.node) = (yyvsp[-1].node); }
+#line 2055 "parse.tab.c"
+    break;
+
+  case 33: /* fplist: fpdef star_fpdef_notest COMMA  */
+#line 186 "includes/parse.y"
+                                        {
+		if ((yyvsp[-1].node)) {
+			reinterpret_cast<ParamNode*>((yyvsp[-1].node))->append((yyvsp[-2].node));
+			(yyval.node) = (yyvsp[-1].node);
+		} else {
+			(yyval.node) = context.pool.make<ParamNode>();
+			reinterpret_cast<ParamNode*>((yyval.node))->append((yyvsp[-2].node));
+		}
+	}
+#line 2069 "parse.tab.c"
+    break;
+
+  case 34: /* fplist: fpdef star_fpdef_notest  */
+#line 195 "includes/parse.y"
+                                  {
+		if ((yyvsp[0].node)) {
+			reinterpret_cast<ParamNode*>((yyvsp[0].node))->append((yyvsp[-1].node));
+			(yyval.node) = (yyvsp[0].node);
+		} else {
+			(yyval.node) = context.pool.make<ParamNode>();
+			reinterpret_cast<ParamNode*>((yyval.node))->append((yyvsp[-1].node));
+		}
+	}
+#line 2083 "parse.tab.c"
+    break;
+
+  case 35: /* star_fpdef_notest: star_fpdef_notest COMMA fpdef  */
+#line 206 "includes/parse.y"
+                                        {
+		if ((yyvsp[-2].node)) {
+			reinterpret_cast<ParamNode*>((yyvsp[-2].node))->append((yyvsp[0].node));
+			(yyval.node) = (yyvsp[-2].node);
+		} else {
+			(yyval.node) = context.pool.make<ParamNode>();
+			reinterpret_cast<ParamNode*>((yyval.node))->append((yyvsp[0].node));
+		}
+	}
+#line 2097 "parse.tab.c"
+    break;
+
+  case 36: /* star_fpdef_notest: %empty  */
+#line 215 "includes/parse.y"
+                 { (yyval.node) = nullptr; }
+#line 2103 "parse.tab.c"
+    break;
+
+  case 37: /* stmt: simple_stmt  */
+#line 218 "includes/parse.y"
+                      {
+		if ((yyvsp[0].node) && Profiler::getInstance().isEnabled()) {
+			Profiler::getInstance().setLine((yyvsp[0].node), (yylsp[0]).first_line);
+		}
+		(yyval.node) = (yyvsp[0].node);
+	}
+#line 2114 "parse.tab.c"
+    break;
+
+  case 38: /* stmt: compound_stmt  */
+#line 224 "includes/parse.y"
+                        {
+		if ((yyvsp[0].node) && Profiler::getInstance().isEnabled()) {
+			Profiler::getInstance().setLine((yyvsp[0].node), (yylsp[0]).first_line);
+		}
+		(yyval.node) = (yyvsp[0].node);
+	}
+#line 2125 "parse.tab.c"
+    break;
+
+  case 43: /* small_stmt: expr_stmt  */
+#line 240 "includes/parse.y"
+                    { (yyval.node) = (yyvsp[0].node); }
+#line 2131 "parse.tab.c"
+    break;
+
+  case 44: /* small_stmt: print_stmt  */
+#line 241 "includes/parse.y"
+                     { (yyval.node) = (yyvsp[0].node); }
+#line 2137 "parse.tab.c"
+    break;
+
+  case 45: /* small_stmt: del_stmt  */
+#line 242 "includes/parse.y"
+                   { (yyval.node) = nullptr; }
+#line 2143 "parse.tab.c"
+    break;
+
+  case 46: /* small_stmt: pass_stmt  */
+#line 243 "includes/parse.y"
+                    { (yyval.node) = nullptr; }
+#line 2149 "parse.tab.c"
+    break;
+
+  case 47: /* small_stmt: flow_stmt  */
+#line 244 "includes/parse.y"
+                    { (yyval.node) = (yyvsp[0].node); }
+#line 2155 "parse.tab.c"
+    break;
+
+  case 48: /* small_stmt: import_stmt  */
+#line 245 "includes/parse.y"
+                      { (yyval.node) = nullptr; }
+#line 2161 "parse.tab.c"
+    break;
+
+  case 49: /* small_stmt: global_stmt  */
+#line 246 "includes/parse.y"
+                      { (yyval.node) = nullptr; }
+#line 2167 "parse.tab.c"
+    break;
+
+  case 50: /* small_stmt: exec_stmt  */
+#line 247 "includes/parse.y"
+                    { (yyval.node) = nullptr; }
+#line 2173 "parse.tab.c"
+    break;
+
+  case 51: /* small_stmt: assert_stmt  */
+#line 248 "includes/parse.y"
+                      { (yyval.node) = nullptr; }
+#line 2179 "parse.tab.c"
+    break;
+
+  case 52: /* expr_stmt: testlist augassign pick_yield_expr_testlist  */
+#line 251 "includes/parse.y"
+                                                      {
+		if (!(yyvsp[-2].node) || !(yyvsp[0].node)) {
+			(yyval.node) = nullptr;
+		} else {
+			Node* res;
+			switch((yyvsp[-1].op)) {
+				case '1':
+					res = context.pool.make<AddBinaryNode>((yyvsp[-2].node), (yyvsp[0].node)); break;
+				case '2':
+					res = context.pool.make<SubBinaryNode>((yyvsp[-2].node), (yyvsp[0].node)); break;
+				case '3':
+					res = context.pool.make<MulBinaryNode>((yyvsp[-2].node), (yyvsp[0].node)); break;
+				case '4':
+					res = context.pool.make<DivBinaryNode>((yyvsp[-2].node), (yyvsp[0].node)); break;
+				case '5':
+					res = context.pool.make<ModBinaryNode>((yyvsp[-2].node), (yyvsp[0].node)); break;
+				case '6':
+					res = context.pool.make<ExpBinaryNode>((yyvsp[-2].node), (yyvsp[0].node)); break;
+				case '7':
+					res = context.pool.make<IntDivBinaryNode>((yyvsp[-2].node), (yyvsp[0].node)); break;
+			}
+			(yyval.node) = context.pool.make<AsgBinaryNode>((yyvsp[-2].node), res);
+		}
+	}
+#line 2208 "parse.tab.c"
+    break;
+
+  case 53: /* expr_stmt: testlist star_EQUAL  */
+#line 275 "includes/parse.y"
+                              {
+		if (!(yyvsp[0].node)) {
+			(yyval.node) = (yyvsp[-1].node);
+		} else {
+			(yyval.node) = context.pool.make<AsgBinaryNode>((yyvsp[-1].node), (yyvsp[0].node));
+		}
+	}
+#line 2220 "parse.tab.c"
+    break;
+
+  case 54: /* pick_yield_expr_testlist: yield_expr  */
+#line 284 "includes/parse.y"
+                     { (yyval.node) = nullptr; }
+#line 2226 "parse.tab.c"
+    break;
+
+  case 56: /* star_EQUAL: EQUAL pick_yield_expr_testlist star_EQUAL  */
+#line 288 "includes/parse.y"
+                                                     {
+		if (!(yyvsp[0].node)) {
+			(yyval.node) = (yyvsp[-1].node);
+		} else {
+			(yyval.node) = context.pool.make<AsgBinaryNode>((yyvsp[-1].node), (yyvsp[0].node));
+		}
+	}
+#line 2238 "parse.tab.c"
+    break;
+
+  case 57: /* star_EQUAL: %empty  */
+#line 295 "includes/parse.y"
+                 { (yyval.node) = nullptr; }
+#line 2244 "parse.tab.c"
+    break;
+
+  case 58: /* augassign: PLUSEQUAL  */
+#line 298 "includes/parse.y"
+                    { (yyval.op) = '1'; }
+#line 2250 "parse.tab.c"
+    break;
+
+  case 59: /* augassign: MINEQUAL  */
+#line 299 "includes/parse.y"
+                    { (yyval.op) = '2'; }
+#line 2256 "parse.tab.c"
+    break;
+
+  case 60: /* augassign: STAREQUAL  */
+#line 300 "includes/parse.y"
+                    { (yyval.op) = '3'; }
+#line 2262 "parse.tab.c"
+    break;
+
+  case 61: /* augassign: SLASHEQUAL  */
+#line 301 "includes/parse.y"
+                     { (yyval.op) = '4'; }
+#line 2268 "parse.tab.c"
+    break;
+
+  case 62: /* augassign: PERCENTEQUAL  */
+#line 302 "includes/parse.y"
+                       { (yyval.op) = '5'; }
+#line 2274 "parse.tab.c"
+    break;
+
+  case 63: /* augassign: AMPEREQUAL  */
+#line 303 "includes/parse.y"
+                     { (yyval.op) = '0'; }
+#line 2280 "parse.tab.c"
+    break;
+
+  case 64: /* augassign: VBAREQUAL  */
+#line 304 "includes/parse.y"
+                     { (yyval.op) = '0'; }
+#line 2286 "parse.tab.c"
+    break;
+
+  case 65: /* augassign: CIRCUMFLEXEQUAL  */
+#line 305 "includes/parse.y"
+                          { (yyval.op) = '0'; }
+#line 2292 "parse.tab.c"
+    break;
+
+  case 66: /* augassign: LEFTSHIFTEQUAL  */
+#line 306 "includes/parse.y"
+                         { (yyval.op) = '0'; }
+#line 2298 "parse.tab.c"
+    break;
+
+  case 67: /* augassign: RIGHTSHIFTEQUAL  */
+#line 307 "includes/parse.y"
+                          { (yyval.op) = '0'; }
+#line 2304 "parse.tab.c"
+    break;
+
+  case 68: /* augassign: DOUBLESTAREQUAL  */
+#line 308 "includes/parse.y"
+                          { (yyval.op) = '6'; }
+#line 2310 "parse.tab.c"
+    break;
+
+  case 69: /* augassign: DOUBLESLASHEQUAL  */
+#line 309 "includes/parse.y"
+                           { (yyval.op) = '7'; }
+#line 2316 "parse.tab.c"
+    break;
+
+  case 70: /* print_stmt: PRINT opt_test  */
+#line 312 "includes/parse.y"
+                         {
+		(yyval.node) = context.pool.make<PrintNode>((yyvsp[0].node));
+	}
+#line 2324 "parse.tab.c"
+    break;
+
+  case 71: /* print_stmt: PRINT RIGHTSHIFT test opt_test_2  */
+#line 315 "includes/parse.y"
+                                           { // print >> sys.stderr, '--'
+		(yyval.node) = nullptr;
+	}
+#line 2332 "parse.tab.c"
+    break;
+
+  case 75: /* opt_test: %empty  */
+#line 325 "includes/parse.y"
+                 { (yyval.node) = nullptr; }
+#line 2338 "parse.tab.c"
+    break;
+
+  case 82: /* flow_stmt: break_stmt  */
+#line 342 "includes/parse.y"
+                     { (yyval.node) = nullptr; }
+#line 2344 "parse.tab.c"
+    break;
+
+  case 83: /* flow_stmt: continue_stmt  */
+#line 343 "includes/parse.y"
+                        { (yyval.node) = nullptr; }
+#line 2350 "parse.tab.c"
+    break;
+
+  case 85: /* flow_stmt: raise_stmt  */
+#line 345 "includes/parse.y"
+                     { (yyval.node) = nullptr; }
+#line 2356 "parse.tab.c"
+    break;
+
+  case 86: /* flow_stmt: yield_stmt  */
+#line 346 "includes/parse.y"
+                     { (yyval.node) = nullptr; }
+#line 2362 "parse.tab.c"
+    break;
+
+  case 89: /* return_stmt: RETURN testlist  */
+#line 355 "includes/parse.y"
+                          {
+		(yyval.node) = context.pool.make<ReturnNode>((yyvsp[0].node));
+	}
+#line 2370 "parse.tab.c"
+    break;
+
+  case 90: /* return_stmt: RETURN  */
+#line 358 "includes/parse.y"
+                 {
+		(yyval.node) = context.pool.make<ReturnNode>();
+	}
+#line 2378 "parse.tab.c"
+    break;
+
+  case 126: /* compound_stmt: if_stmt  */
+#line 436 "includes/parse.y"
+                  { (yyval.node) = (yyvsp[0].node); }
+#line 2384 "parse.tab.c"
+    break;
+
+  case 127: /* compound_stmt: while_stmt  */
+#line 437 "includes/parse.y"
+                     { (yyval.node) = nullptr; }
+#line 2390 "parse.tab.c"
+    break;
+
+  case 128: /* compound_stmt: for_stmt  */
+#line 438 "includes/parse.y"
+                   { (yyval.node) = nullptr; }
+#line 2396 "parse.tab.c"
+    break;
+
+  case 129: /* compound_stmt: try_stmt  */
+#line 439 "includes/parse.y"
+                   { (yyval.node) = nullptr; }
+#line 2402 "parse.tab.c"
+    break;
+
+  case 130: /* compound_stmt: with_stmt  */
+#line 440 "includes/parse.y"
+                    { (yyval.node) = nullptr; }
+#line 2408 "parse.tab.c"
+    break;
+
+  case 131: /* compound_stmt: funcdef  */
+#line 441 "includes/parse.y"
+                  { (yyval.node) = (yyvsp[0].node); }
+#line 2414 "parse.tab.c"
+    break;
+
+  case 132: /* compound_stmt: classdef  */
+#line 442 "includes/parse.y"
+                   { (yyval.node) = nullptr; }
+#line 2420 "parse.tab.c"
+    break;
+
+  case 133: /* compound_stmt: decorated  */
+#line 443 "includes/parse.y"
+                    { (yyval.node) = nullptr; }
+#line 2426 "parse.tab.c"
+    break;
+
+  case 134: /* if_stmt: IF test COLON suite star_ELIF ELSE COLON suite  */
+#line 446 "includes/parse.y"
+                                                         {
+		(yyval.node) = context.pool.make<IfNode>((yyvsp[-6].node), (yyvsp[-4].node), (yyvsp[0].node));
+	}
+#line 2434 "parse.tab.c"
+    break;
+
+  case 135: /* if_stmt: IF test COLON suite star_ELIF  */
+#line 449 "includes/parse.y"
+                                        {
+		(yyval.node) = context.pool.make<IfNode>((yyvsp[-3].node), (yyvsp[-1].node), nullptr);
+	}
+#line 2442 "parse.tab.c"
+    break;
+
+  case 161: /* suite: simple_stmt  */
+#line 505 "includes/parse.y"
+                      {
+		SuiteNode* suite = context.pool.make<SuiteNode>();
+		suite->append((yyvsp[0].node));
+		(yyval.node) = suite;
+	}
+#line 2452 "parse.tab.c"
+    break;
+
+  case 162: /* suite: NEWLINE INDENT plus_stmt DEDENT  */
+#line 510 "includes/parse.y"
+                                          { (yyval.node) = (yyvsp[-1].node); }
+#line 2458 "parse.tab.c"
+    break;
+
+  case 163: /* plus_stmt: plus_stmt stmt  */
+#line 513 "includes/parse.y"
+                         {
+		static_cast<SuiteNode*>((yyvsp[-1].node))->append((yyvsp[0].node));
+		(yyval.node) = (yyvsp[-1].node);
+	}
+#line 2467 "parse.tab.c"
+    break;
+
+  case 164: /* plus_stmt: stmt  */
+#line 517 "includes/parse.y"
+               {
+		(yyval.node) = context.pool.make<SuiteNode>();
+		static_cast<SuiteNode*>((yyval.node))->append((yyvsp[0].node));
+	}
+#line 2476 "parse.tab.c"
+    break;
+
+  case 173: /* test: or_test opt_IF_ELSE  */
+#line 539 "includes/parse.y"
+                              { (yyval.node) = (yyvsp[-1].node); }
+#line 2482 "parse.tab.c"
+    break;
+
+  case 174: /* test: lambdef  */
+#line 540 "includes/parse.y"
+                  { (yyval.node) = nullptr; }
+#line 2488 "parse.tab.c"
+    break;
+
+  case 175: /* opt_IF_ELSE: IF or_test ELSE test  */
+#line 543 "includes/parse.y"
+                               { (yyval.node) = (yyvsp[-2].node); }
+#line 2494 "parse.tab.c"
+    break;
+
+  case 176: /* opt_IF_ELSE: %empty  */
+#line 544 "includes/parse.y"
+                 { (yyval.node) = nullptr; }
+#line 2500 "parse.tab.c"
+    break;
+
+  case 177: /* or_test: and_test  */
+#line 547 "includes/parse.y"
+                   { (yyval.node) = (yyvsp[0].node); }
+#line 2506 "parse.tab.c"
+    break;
+
+  case 178: /* or_test: or_test OR and_test  */
+#line 548 "includes/parse.y"
+                              { (yyval.node) = nullptr; }
+#line 2512 "parse.tab.c"
+    break;
+
+  case 179: /* and_test: not_test  */
+#line 551 "includes/parse.y"
+                   { (yyval.node) = (yyvsp[0].node); }
+#line 2518 "parse.tab.c"
+    break;
+
+  case 180: /* and_test: and_test AND not_test  */
+#line 552 "includes/parse.y"
+                                { (yyval.node) = nullptr; }
+#line 2524 "parse.tab.c"
+    break;
+
+  case 181: /* not_test: NOT not_test  */
+#line 555 "includes/parse.y"
+                       { (yyval.node) = nullptr; }
+#line 2530 "parse.tab.c"
+    break;
+
+  case 182: /* not_test: comparison  */
+#line 556 "includes/parse.y"
+                     { (yyval.node) = (yyvsp[0].node); }
+#line 2536 "parse.tab.c"
+    break;
+
+  case 183: /* comparison: expr  */
+#line 559 "includes/parse.y"
+               { (yyval.node) = (yyvsp[0].node); }
+#line 2542 "parse.tab.c"
+    break;
+
+  case 184: /* comparison: comparison comp_op expr  */
+#line 560 "includes/parse.y"
+                                  {
+		if (isOpEqual((yyvsp[-1].cmp), "<")) {
+			(yyval.node) = context.pool.make<LessBinaryNode>((yyvsp[-2].node), (yyvsp[0].node));
+		} else if (isOpEqual((yyvsp[-1].cmp), ">")) {
+			(yyval.node) = context.pool.make<GreaterBinaryNode>((yyvsp[-2].node), (yyvsp[0].node));
+		} else if (isOpEqual((yyvsp[-1].cmp), "==")) {
+			(yyval.node) = context.pool.make<EqualBinaryNode>((yyvsp[-2].node), (yyvsp[0].node));
+		} else if (isOpEqual((yyvsp[-1].cmp), ">=")) {
+			(yyval.node) = context.pool.make<GrtEqBinaryNode>((yyvsp[-2].node), (yyvsp[0].node));
+		} else if (isOpEqual((yyvsp[-1].cmp), "<=")) {
+			(yyval.node) = context.pool.make<LessEqBinaryNode>((yyvsp[-2].node), (yyvsp[0].node));
+		}
+	}
+#line 2560 "parse.tab.c"
+    break;
+
+  case 185: /* comp_op: LESS  */
+#line 575 "includes/parse.y"
+               { (yyval.cmp) = "<"; }
+#line 2566 "parse.tab.c"
+    break;
+
+  case 186: /* comp_op: GREATER  */
+#line 576 "includes/parse.y"
+                  { (yyval.cmp) = ">"; }
+#line 2572 "parse.tab.c"
+    break;
+
+  case 187: /* comp_op: EQEQUAL  */
+#line 577 "includes/parse.y"
+                  { (yyval.cmp) = "=="; }
+#line 2578 "parse.tab.c"
+    break;
+
+  case 188: /* comp_op: GREATEREQUAL  */
+#line 578 "includes/parse.y"
+                       { (yyval.cmp) = ">="; }
+#line 2584 "parse.tab.c"
+    break;
+
+  case 189: /* comp_op: LESSEQUAL  */
+#line 579 "includes/parse.y"
+                    { (yyval.cmp) = "<="; }
+#line 2590 "parse.tab.c"
+    break;
+
+  case 190: /* comp_op: GRLT  */
+#line 580 "includes/parse.y"
+               { (yyval.cmp) = ""; }
+#line 2596 "parse.tab.c"
+    break;
+
+  case 191: /* comp_op: NOTEQUAL  */
+#line 581 "includes/parse.y"
+                   { (yyval.cmp) = "!="; }
+#line 2602 "parse.tab.c"
+    break;
+
+  case 192: /* comp_op: IN  */
+#line 582 "includes/parse.y"
+             { (yyval.cmp) = ""; }
+#line 2608 "parse.tab.c"
+    break;
+
+  case 193: /* comp_op: NOT IN  */
+#line 583 "includes/parse.y"
+                 { (yyval.cmp) = ""; }
+#line 2614 "parse.tab.c"
+    break;
+
+  case 194: /* comp_op: IS  */
+#line 584 "includes/parse.y"
+             { (yyval.cmp) = ""; }
+#line 2620 "parse.tab.c"
+    break;
+
+  case 195: /* comp_op: IS NOT  */
+#line 585 "includes/parse.y"
+                 { (yyval.cmp) = ""; }
+#line 2626 "parse.tab.c"
+    break;
+
+  case 197: /* expr: expr BAR xor_expr  */
+#line 589 "includes/parse.y"
+                            { (yyval.node) = nullptr; }
+#line 2632 "parse.tab.c"
+    break;
+
+  case 199: /* xor_expr: xor_expr CIRCUMFLEX and_expr  */
+#line 593 "includes/parse.y"
+                                       { (yyval.node) = nullptr; }
+#line 2638 "parse.tab.c"
+    break;
+
+  case 201: /* and_expr: and_expr AMPERSAND shift_expr  */
+#line 597 "includes/parse.y"
+                                        { (yyval.node) = nullptr; }
+#line 2644 "parse.tab.c"
+    break;
+
+  case 203: /* shift_expr: shift_expr pick_LEFTSHIFT_RIGHTSHIFT arith_expr  */
+#line 601 "includes/parse.y"
+                                                          { (yyval.node) = nullptr; }
+#line 2650 "parse.tab.c"
+    break;
+
+  case 207: /* arith_expr: arith_expr pick_PLUS_MINUS term  */
+#line 609 "includes/parse.y"
+                                          {
+		if ((yyvsp[-1].op) == '+') {
+			(yyval.node) = context.pool.make<AddBinaryNode>((yyvsp[-2].node), (yyvsp[0].node));
+		}
+		if ((yyvsp[-1].op) == '-') {
+			(yyval.node) = context.pool.make<SubBinaryNode>((yyvsp[-2].node), (yyvsp[0].node));
+		}
+	}
+#line 2663 "parse.tab.c"
+    break;
+
+  case 208: /* pick_PLUS_MINUS: PLUS  */
+#line 619 "includes/parse.y"
+               { (yyval.op) = '+'; }
+#line 2669 "parse.tab.c"
+    break;
+
+  case 209: /* pick_PLUS_MINUS: MINUS  */
+#line 620 "includes/parse.y"
+                { (yyval.op) = '-'; }
+#line 2675 "parse.tab.c"
+    break;
+
+  case 211: /* term: term pick_multop factor  */
+#line 624 "includes/parse.y"
+                                  {
+		switch((yyvsp[-1].op)) {
+			case '*':
+				(yyval.node) = context.pool.make<MulBinaryNode>((yyvsp[-2].node), (yyvsp[0].node));
+				break;
+			case '/':
+				(yyval.node) = context.pool.make<DivBinaryNode>((yyvsp[-2].node), (yyvsp[0].node));
+				break;
+			case '%':
+				(yyval.node) = context.pool.make<ModBinaryNode>((yyvsp[-2].node), (yyvsp[0].node));
+				break;
+			case '@':
+				(yyval.node) = context.pool.make<IntDivBinaryNode>((yyvsp[-2].node), (yyvsp[0].node));
+				break;
+			default:
+				(yyval.node) = nullptr; break;
+		};
+	}
+#line 2698 "parse.tab.c"
+    break;
+
+  case 212: /* pick_multop: STAR  */
+#line 644 "includes/parse.y"
+               { (yyval.op) = '*'; }
+#line 2704 "parse.tab.c"
+    break;
+
+  case 213: /* pick_multop: SLASH  */
+#line 645 "includes/parse.y"
+                { (yyval.op) = '/'; }
+#line 2710 "parse.tab.c"
+    break;
+
+  case 214: /* pick_multop: PERCENT  */
+#line 646 "includes/parse.y"
+                  { (yyval.op) = '%'; }
+#line 2716 "parse.tab.c"
+    break;
+
+  case 215: /* pick_multop: DOUBLESLASH  */
+#line 647 "includes/parse.y"
+                      { (yyval.op) = '@'; }
+#line 2722 "parse.tab.c"
+    break;
+
+  case 216: /* factor: pick_unop factor  */
+#line 650 "includes/parse.y"
+                           { (yyval.node) = context.pool.make<UnaryNode>((yyvsp[-1].op), (yyvsp[0].node)); }
+#line 2728 "parse.tab.c"
+    break;
+
+  case 218: /* pick_unop: PLUS  */
+#line 654 "includes/parse.y"
+                { (yyval.op) = '+'; }
+#line 2734 "parse.tab.c"
+    break;
+
+  case 219: /* pick_unop: MINUS  */
+#line 655 "includes/parse.y"
+                { (yyval.op) = '-'; }
+#line 2740 "parse.tab.c"
+    break;
+
+  case 220: /* pick_unop: TILDE  */
+#line 656 "includes/parse.y"
+                { (yyval.op) = '~'; }
+#line 2746 "parse.tab.c"
+    break;
+
+  case 221: /* power: atom star_trailer DOUBLESTAR factor  */
+#line 659 "includes/parse.y"
+                                              {	// pow(atom, factor)
+		(yyval.node) = context.pool.make<ExpBinaryNode>((yyvsp[-3].node), (yyvsp[0].node));
+	}
+#line 2754 "parse.tab.c"
+    break;
+
+  case 222: /* power: atom star_trailer  */
+#line 662 "includes/parse.y"
+                            {	// star_trailer: zero or more (), [], .xxx
+		// if ($1 && ($<intNumber>2 == 1)) {
+		if ((yyvsp[-1].node) && !(yyvsp[0].node)) {
+			(yyval.node) = (yyvsp[-1].node);
+		} else {
+			// reinterpret_cast cheaper than dynamic_cast
+			(yyval.node) = context.pool.make<CallNode>(static_cast<IdentNode*>((yyvsp[-1].node))->getAtom(), (yyvsp[0].node));
+		}
+	}
+#line 2768 "parse.tab.c"
+    break;
+
+  case 223: /* star_trailer: star_trailer trailer  */
+#line 673 "includes/parse.y"
+                               {
+		// $<intNumber>$ = 0;
+		// TODO: ONE trailer
+		(yyval.node) = (yyvsp[0].node);
+	}
+#line 2778 "parse.tab.c"
+    break;
+
+  case 224: /* star_trailer: %empty  */
+#line 678 "includes/parse.y"
+                 {
+		// $<intNumber>$ = 1;
+		(yyval.node) = nullptr;
+	}
+#line 2787 "parse.tab.c"
+    break;
+
+  case 225: /* atom: LPAR opt_yield_test RPAR  */
+#line 684 "includes/parse.y"
+                                   { (yyval.node) = nullptr; }
+#line 2793 "parse.tab.c"
+    break;
+
+  case 226: /* atom: LSQB opt_listmaker RSQB  */
+#line 685 "includes/parse.y"
+                                  { (yyval.node) = nullptr; }
+#line 2799 "parse.tab.c"
+    break;
+
+  case 227: /* atom: LBRACE opt_dictorsetmaker RBRACE  */
+#line 686 "includes/parse.y"
+                                           { (yyval.node) = nullptr; }
+#line 2805 "parse.tab.c"
+    break;
+
+  case 228: /* atom: BACKQUOTE testlist1 BACKQUOTE  */
+#line 687 "includes/parse.y"
+                                        { (yyval.node) = nullptr; }
+#line 2811 "parse.tab.c"
+    break;
+
+  case 229: /* atom: NAME  */
+#line 688 "includes/parse.y"
+               {
+		(yyval.node) = context.pool.make<IdentNode>((yyvsp[0].atom));
+	}
+#line 2819 "parse.tab.c"
+    break;
+
+  case 230: /* atom: NUMBER  */
+#line 691 "includes/parse.y"
+                 { (yyval.node) = nullptr; }
+#line 2825 "parse.tab.c"
+    break;
+
+  case 231: /* atom: INT  */
+#line 692 "includes/parse.y"
+              {
+		(yyval.node) = context.constants.integer((yyvsp[0].intNumber));
+	}
+#line 2833 "parse.tab.c"
+    break;
+
+  case 232: /* atom: LONGINT  */
+#line 695 "includes/parse.y"
+                  {
+		(yyval.node) = context.constants.integer(BigInt::parse((yyvsp[0].view).text, (yyvsp[0].view).length));
+	}
+#line 2841 "parse.tab.c"
+    break;
+
+  case 233: /* atom: FLOAT  */
+#line 698 "includes/parse.y"
+                {
+		(yyval.node) = context.constants.number((yyvsp[0].fltNumber));
+	}
+#line 2849 "parse.tab.c"
+    break;
+
+  case 234: /* atom: plus_STRING  */
+#line 701 "includes/parse.y"
+                      {
+		(yyval.node) = nullptr;
+		if ((yyvsp[0].text)) {
+			(yyval.node) = context.constants.string((yyvsp[0].text)->data(), (yyvsp[0].text)->size());
+			delete (yyvsp[0].text);
+		}
+	}
+#line 2861 "parse.tab.c"
+    break;
+
+  case 243: /* plus_STRING: plus_STRING STRING  */
+#line 726 "includes/parse.y"
+                             {
+		// adjacent literals are joined; long strings carry no text
+		(yyval.text) = (yyvsp[-1].text);
+		if ((yyval.text) && (yyvsp[0].view).text) {
+			appendString(*(yyval.text), (yyvsp[0].view));
+		} else {
+			delete (yyval.text);
+			(yyval.text) = nullptr;
+		}
+	}
+#line 2876 "parse.tab.c"
+    break;
+
+  case 244: /* plus_STRING: STRING  */
+#line 736 "includes/parse.y"
+                 {
+		(yyval.text) = nullptr;
+		if ((yyvsp[0].view).text) {
+			(yyval.text) = new std::string();
+			appendString(*(yyval.text), (yyvsp[0].view));
+		}
+	}
+#line 2888 "parse.tab.c"
+    break;
+
+  case 251: /* trailer: LPAR opt_arglist RPAR  */
+#line 757 "includes/parse.y"
+                                {
+		if ((yyvsp[-1].node)) {
+			(yyval.node) = (yyvsp[-1].node);
+		} else {
+			(yyval.node) = context.pool.make<ParamNode>();
+		}
+	}
+#line 2900 "parse.tab.c"
+    break;
+
+  case 252: /* trailer: LSQB subscriptlist RSQB  */
+#line 764 "includes/parse.y"
+                                  { (yyval.node) = nullptr; }
+#line 2906 "parse.tab.c"
+    break;
+
+  case 253: /* trailer: DOT NAME  */
+#line 765 "includes/parse.y"
+                   { (yyval.node) = nullptr; }
+#line 2912 "parse.tab.c"
+    break;
+
+  case 285: /* arglist: star_argument_COMMA pick_argument  */
+#line 829 "includes/parse.y"
+                                            {
+		if ((yyvsp[-1].node)) {
+			// ParamNode already created
+			if ((yyvsp[0].node)) {
+				// another argument
+				reinterpret_cast<ParamNode*>((yyvsp[-1].node))->append((yyvsp[0].node));
+			}
+			(yyval.node) = (yyvsp[-1].node);
+		} else {
+			// no ParamNode
+			(yyval.node) = context.pool.make<ParamNode>();
+			reinterpret_cast<ParamNode*>((yyval.node))->append((yyvsp[0].node));
+		}
+	}
+#line 2931 "parse.tab.c"
+    break;
+
+  case 286: /* star_argument_COMMA: star_argument_COMMA argument COMMA  */
+#line 845 "includes/parse.y"
+                                             {
+		if ((yyvsp[-2].node)) {
+			reinterpret_cast<ParamNode*>((yyvsp[-2].node))->append((yyvsp[-1].node));
+			(yyval.node) = (yyvsp[-2].node);
+		} else {
+			(yyval.node) = context.pool.make<ParamNode>();
+			reinterpret_cast<ParamNode*>((yyval.node))->append((yyvsp[-1].node));
+		}
+	}
+#line 2945 "parse.tab.c"
+    break;
+
+  case 287: /* star_argument_COMMA: %empty  */
+#line 854 "includes/parse.y"
+                 { (yyval.node) = nullptr; }
+#line 2951 "parse.tab.c"
+    break;
+
+  case 292: /* pick_argument: argument opt_COMMA  */
+#line 865 "includes/parse.y"
+                             { (yyval.node) = (yyvsp[-1].node); }
+#line 2957 "parse.tab.c"
+    break;
+
+  case 293: /* pick_argument: STAR test star_COMMA_argument opt_DOUBLESTAR_test  */
+#line 866 "includes/parse.y"
+                                                            {
+		// TODO: *args
+		(yyval.node) = nullptr;
+	}
+#line 2966 "parse.tab.c"
+    break;
+
+  case 294: /* pick_argument: DOUBLESTAR test  */
+#line 870 "includes/parse.y"
+                          {
+		// TODO: **kwargs
+		(yyval.node) = nullptr;
+	}
+#line 2975 "parse.tab.c"
+    break;
+
+  case 295: /* argument: test opt_comp_for  */
+#line 876 "includes/parse.y"
+                            { (yyval.node) = (yyvsp[-1].node); }
+#line 2981 "parse.tab.c"
+    break;
+
+  case 296: /* argument: test EQUAL test  */
+#line 877 "includes/parse.y"
+                          {
+		(yyval.node) = context.pool.make<AsgBinaryNode>((yyvsp[-2].node), (yyvsp[0].node));
+	}
+#line 2989 "parse.tab.c"
+    break;
+
+
+#line 2993 "parse.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+  *++yylsp = yyloc;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (&yylloc, scanner, context, YY_("syntax error"));
+    }
+
+  yyerror_range[1] = yylloc;
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, &yylloc, scanner, context);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+      yyerror_range[1] = *yylsp;
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, yylsp, scanner, context);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  yyerror_range[2] = yylloc;
+  ++yylsp;
+  YYLLOC_DEFAULT (*yylsp, yyerror_range, 2);
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (&yylloc, scanner, context, YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval, &yylloc, scanner, context);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, yylsp, scanner, context);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 922 "includes/parse.y"
+
+
+#include <iostream>
+void yyerror (YYLTYPE *yylloc, yyscan_t scanner, ParseContext&, const char *s)
+{
+    std::ostream& errors = Interpreter::getInstance().getErrors();
+    if(yylloc->first_line > 0)	{
+        errors << yylloc->first_line << "." << yylloc->first_column << "-"
+               << yylloc->last_line << "." << yylloc->last_column << ":";
+    }
+    errors << " " << s << " with [" << yyget_text(scanner) << "]" << std::endl;
+}
+
+// decodes a short string token, prefix and quotes included
+void appendString(std::string& res, const TokenView& view)
+{
+	bool raw = false;
+	const char* token = view.text;
+	const char* end = view.text + view.length - 1;
+	while (*token != '\'' && *token != '"') {
+		if (*token == 'r' || *token == 'R') raw = true;
+		++token;
+	}
+	for (const char* p = token + 1; p < end; ++p) {
+		if (*p != '\\' || raw) {
+			res += *p;
+			if (raw && *p == '\\' && p + 1 < end) res += *++p;
+			continue;
+		}
+		char c = *++p;
+		switch (c) {
+			case 'n': res += '\n'; break;
+			case 't': res += '\t'; break;
+			case 'r': res += '\r'; break;
+			case 'a': res += '\a'; break;
+			case 'b': res += '\b'; break;
+			case 'f': res += '\f'; break;
+			case 'v': res += '\v'; break;
+			case '\\': case '\'': case '"': res += c; break;
+			case '\n': break;
+			case 'x':
+				if (p + 2 < end && isxdigit(p[1]) && isxdigit(p[2])) {
+					res += static_cast<char>(strtol(std::string(p + 1, 2).c_str(), nullptr, 16));
+					p += 2;
+					break;
+				}
+				throw std::string("ValueError: invalid \\x escape");
+			default:
+				if (c >= '0' && c <= '7') {
+					int val = 0;
+					for (int k = 0; k < 3 && p < end && *p >= '0' && *p <= '7'; ++k) {
+						val = val * 8 + (*p++ - '0');
+					}
+					--p;
+					res += static_cast<char>(val);
+				} else {
+					res += '\\';
+					res += c;
+				}
+		}
+	}
+}
+
+bool isOpEqual(const char* op1, const char* op2)
+{
+	if (strcmp(op1, op2) == 0) return true;
+	return false;
+}
@@ -0,0 +1,197 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_PARSE_TAB_H_INCLUDED
+# define YY_YY_PARSE_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+/* "%code requires" blocks.  */
+#line 2 "includes/parse.y"
+
+#include "includes/parser.h"
+#include "includes/source.h"
+
+#line 54 "parse.tab.h"
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    INT = 258,                     /* INT  */
+    FLOAT = 259,                   /* FLOAT  */
+    NAME = 260,                    /* NAME  */
+    STRING = 261,                  /* STRING  */
+    LONGINT = 262,                 /* LONGINT  */
+    AMPEREQUAL = 263,              /* AMPEREQUAL  */
+    AMPERSAND = 264,               /* AMPERSAND  */
+    AND = 265,                     /* AND  */
+    AS = 266,                      /* AS  */
+    ASSERT = 267,                  /* ASSERT  */
+    AT = 268,                      /* AT  */
+    BACKQUOTE = 269,               /* BACKQUOTE  */
+    BAR = 270,                     /* BAR  */
+    BREAK = 271,                   /* BREAK  */
+    CIRCUMFLEX = 272,              /* CIRCUMFLEX  */
+    CIRCUMFLEXEQUAL = 273,         /* CIRCUMFLEXEQUAL  */
+    CLASS = 274,                   /* CLASS  */
+    COLON = 275,                   /* COLON  */
+    COMMA = 276,                   /* COMMA  */
+    CONTINUE = 277,                /* CONTINUE  */
+    DEDENT = 278,                  /* DEDENT  */
+    DEF = 279,                     /* DEF  */
+    DEL = 280,                     /* DEL  */
+    DOT = 281,                     /* DOT  */
+    DOUBLESLASH = 282,             /* DOUBLESLASH  */
+    DOUBLESLASHEQUAL = 283,        /* DOUBLESLASHEQUAL  */
+    DOUBLESTAR = 284,              /* DOUBLESTAR  */
+    DOUBLESTAREQUAL = 285,         /* DOUBLESTAREQUAL  */
+    ELIF = 286,                    /* ELIF  */
+    ELSE = 287,                    /* ELSE  */
+    ENDMARKER = 288,               /* ENDMARKER  */
+    EQEQUAL = 289,                 /* EQEQUAL  */
+    EQUAL = 290,                   /* EQUAL  */
+    EXCEPT = 291,                  /* EXCEPT  */
+    EXEC = 292,                    /* EXEC  */
+    FINALLY = 293,                 /* FINALLY  */
+    FOR = 294,                     /* FOR  */
+    FROM = 295,                    /* FROM  */
+    GLOBAL = 296,                  /* GLOBAL  */
+    GREATER = 297,                 /* GREATER  */
+    GREATEREQUAL = 298,            /* GREATEREQUAL  */
+    GRLT = 299,                    /* GRLT  */
+    IF = 300,                      /* IF  */
+    IMPORT = 301,                  /* IMPORT  */
+    IN = 302,                      /* IN  */
+    INDENT = 303,                  /* INDENT  */
+    IS = 304,                      /* IS  */
+    LAMBDA = 305,                  /* LAMBDA  */
+    LBRACE = 306,                  /* LBRACE  */
+    LEFTSHIFT = 307,               /* LEFTSHIFT  */
+    LEFTSHIFTEQUAL = 308,          /* LEFTSHIFTEQUAL  */
+    LESS = 309,                    /* LESS  */
+    LESSEQUAL = 310,               /* LESSEQUAL  */
+    LPAR = 311,                    /* LPAR  */
+    LSQB = 312,                    /* LSQB  */
+    MINEQUAL = 313,                /* MINEQUAL  */
+    MINUS = 314,                   /* MINUS  */
+    NEWLINE = 315,                 /* NEWLINE  */
+    NOT = 316,                     /* NOT  */
+    NOTEQUAL = 317,                /* NOTEQUAL  */
+    NUMBER = 318,                  /* NUMBER  */
+    OR = 319,                      /* OR  */
+    PASS = 320,                    /* PASS  */
+    PERCENT = 321,                 /* PERCENT  */
+    PERCENTEQUAL = 322,            /* PERCENTEQUAL  */
+    PLUS = 323,                    /* PLUS  */
+    PLUSEQUAL = 324,               /* PLUSEQUAL  */
+    PRINT = 325,                   /* PRINT  */
+    RAISE = 326,                   /* RAISE  */
+    RBRACE = 327,                  /* RBRACE  */
+    RETURN = 328,                  /* RETURN  */
+    RIGHTSHIFT = 329,              /* RIGHTSHIFT  */
+    RIGHTSHIFTEQUAL = 330,         /* RIGHTSHIFTEQUAL  */
+    RPAR = 331,                    /* RPAR  */
+    RSQB = 332,                    /* RSQB  */
+    SEMI = 333,                    /* SEMI  */
+    SLASH = 334,                   /* SLASH  */
+    SLASHEQUAL = 335,              /* SLASHEQUAL  */
+    STAR = 336,                    /* STAR  */
+    STAREQUAL = 337,               /* STAREQUAL  */
+    TILDE = 338,                   /* TILDE  */
+    TRY = 339,                     /* TRY  */
+    VBAREQUAL = 340,               /* VBAREQUAL  */
+    WHILE = 341,                   /* WHILE  */
+    WITH = 342,                    /* WITH  */
+    YIELD = 343                    /* YIELD  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 33 "includes/parse.y"
+
+	Node* node;
+	long intNumber;
+	double fltNumber;
+	char op; // operator
+	const char* cmp; // compare operator
+	TokenView view; // STRING and LONGINT, in the source
+	const Atom* atom;
+	std::string* text;
+
+#line 170 "parse.tab.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+/* Location type.  */
+#if ! defined YYLTYPE && ! defined YYLTYPE_IS_DECLARED
+typedef struct YYLTYPE YYLTYPE;
+struct YYLTYPE
+{
+  int first_line;
+  int first_column;
+  int last_line;
+  int last_column;
+};
+# define YYLTYPE_IS_DECLARED 1
+# define YYLTYPE_IS_TRIVIAL 1
+#endif
+
+
+
+
+int yyparse (yyscan_t scanner, ParseContext& context);
+
+
+#endif /* !YY_YY_PARSE_TAB_H_INCLUDED  */
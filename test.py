@@ -31,11 +31,39 @@ if not os.path.isfile( executable ):
   retcode = subprocess.call("make",shell=True)
   testCode( retcode, "\tFAILED to make the scanner" )
 
+# what python prints, ending with the error if the case raises one: the
+# last line of the traceback, as ./run reports it on standard output
 def generateResult(testFile, outFile):
-    retcode = subprocess.call("python "+testFile+">"+outFile, shell=True)
-    fileH = open(output, 'r')
+    retcode = subprocess.call("python -u "+testFile+">"+outFile+" 2>&1", shell=True)
+    fileH = open(outFile, 'r')
     lines = fileH.readlines()
     fileH.close()
+    fileH = open(outFile, 'w')
+    for line in lines:
+      if not line.startswith("Traceback (most recent call last):") and not line.startswith("  "):
+        fileH.write(line)
+    fileH.close()
+
+# every case runs once plainly, then under each engine and tier that
+# should give the same output
+flagSets = [ "", "--jit=threshold=0", "--engine=vm", "--memoize",
+             "--warmup=1", "--gc-threshold=1" ]
+
+# runs command, which writes to /tmp/out, and compares what it printed
+# with output; its exit status
+def runCase(command, name, output):
+  retcode = subprocess.call(command+"> /tmp/out",shell=True)
+  if retcode < 0:
+    testCode( -retcode, "\tFAILED to run test case "+name)
+  if not os.path.isfile( output ):
+    print bcolors.FAIL + "test case", output, "doesn't exist" + bcolors.ENDC
+    sys.exit( 1 )
+  if not filecmp.cmp("/tmp/out", output):
+    subprocess.call("diff "+output+" /tmp/out -y",shell=True)
+    print bcolors.FAIL + "\tTEST CASE FAILED", name + bcolors.ENDC
+  else :
+    print bcolors.OKGREEN + "testcase:", name, "passed" + bcolors.ENDC
+  return retcode
 
 files = os.listdir( testDir )
 for x in files:
@@ -44,17 +72,21 @@ for x in files:
     output = testcase[:-3]+".out"
     generateResult(testcase, output)
 
-    retcode = subprocess.call("./run < "+testcase+"> /tmp/out",shell=True)
-    if retcode < 0:
-      testCode( retcode, "\tFAILED to run test case "+x)
-    else:
-      if not os.path.isfile( output ):
-        print bcolors.FAIL + "test case", x[:-3]+'.out', "doesn't exist" + bcolors.ENDC
-        sys.exit( 1 )
-      if not filecmp.cmp("/tmp/out", output):
-        subprocess.call("diff "+output+" /tmp/out -y",shell=True)
-        print bcolors.FAIL + "\tTEST CASE FAILED", x + bcolors.ENDC
-      else :
-        print bcolors.OKGREEN + "testcase:", x, "passed" + bcolors.ENDC
+    for flags in flagSets:
+      runCase("./run "+flags+" < "+testcase, (x+" "+flags).strip(), output)
+
+    # from the file, twice: the first run writes the case's .mpyc (if it
+    # runs to the end), the second runs the program loaded from it
+    cache = testcase[:-3]+".mpyc"
+    if os.path.isfile( cache ):
+      os.remove( cache )
+    retcode = runCase("./run "+testcase, x+" (cache written)", output)
+    if retcode == 0 and not os.path.isfile( cache ):
+      print bcolors.FAIL + "\tTEST CASE FAILED", x, "(no cache written)" + bcolors.ENDC
+    runCase("./run "+testcase, x+" (cache loaded)", output)
+
 
 
+# the library, which has to come back from every error a script makes
+retcode = subprocess.call("make embed_test && ./embed_test", shell=True)
+testCode( retcode, "\tFAILED libmypy checks (tests/embed_test.cpp)" )
@@ -0,0 +1,98 @@
+//  Checks of libmypy: an interpreter that outlives its scripts has to
+//  come back from every error as it was, under each engine, and keep
+//  what one script leaves out of the next one's cache.
+//
+//  usage: embed_test   (exit status 1 if a check fails)
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unistd.h>
+#include "../includes/mypy.h"
+
+namespace {
+
+int failures = 0;
+
+void check(const char* engine, const std::string& what, const mypy::Result& result,
+           int status, const std::string& output) {
+  if (result.status != status || result.output != output) {
+    std::cerr << engine << ": " << what << ": got status " << result.status << " \""
+              << result.output << "\" " << result.errors << ", wanted " << status
+              << " \"" << output << "\"" << std::endl;
+    ++failures;
+  }
+}
+
+// errors raised inside calls, many more than the recursion limit, and
+// then calls that work
+void errorsInCalls(const char* engine, const mypy::Interpreter::Options& options) {
+  mypy::Interpreter python(options);
+  check(engine, "define", python.run(
+    "def f(x):\n"
+    "    return 1 / x\n"
+    "def g(x):\n"
+    "    return f(x) + 1\n"
+    "def down(n):\n"
+    "    return down(n + 1)\n"), 0, "");
+  const std::string zero = "ZeroDivisionError: integer division or modulo by zero\n";
+  for (int i = 0; i < 1100; ++i) {
+    const mypy::Result result = python.run("print g(0)\n");
+    if (result.status != 1 || result.output != zero) {
+      check(engine, "failing call " + std::to_string(i), result, 1, zero);
+      break;
+    }
+  }
+  const std::string deep = "RuntimeError: maximum recursion depth exceeded\n";
+  for (int i = 0; i < 20; ++i) {
+    const mypy::Result result = python.run("print down(0)\n");
+    if (result.status != 1 || result.output != deep) {
+      check(engine, "runaway recursion " + std::to_string(i), result, 1, deep);
+      break;
+    }
+  }
+  check(engine, "after the errors", python.run("print 1\n"), 0, "1\n");
+  check(engine, "a call after the errors", python.run("print g(1)\n"), 0, "2\n");
+}
+
+void write(const std::string& path, const std::string& text) {
+  std::ofstream(path.c_str()) << text;
+}
+
+// a file's cache holds that file's statements and nothing run around it
+void cacheOfEachFile() {
+  const std::string stem = "/tmp/embed_test_" + std::to_string(getpid());
+  const std::string a = stem + "_a.py", b = stem + "_b.py";
+  write(a, "print 'from a'\n");
+  write(b, "print 'from b'\n");
+  {
+    mypy::Interpreter python;
+    check("cache", "first file", python.runFile(a), 0, "from a\n");
+    check("cache", "text", python.run("print 'text'\n"), 0, "text\n");
+    check("cache", "second file", python.runFile(b), 0, "from b\n");
+  }
+  mypy::Interpreter fresh;
+  check("cache", "second file, cached", fresh.runFile(b), 0, "from b\n");
+  for (const std::string& path : { a, b, stem + "_a.mpyc", stem + "_b.mpyc" }) {
+    std::remove(path.c_str());
+  }
+}
+
+}
+
+int main() {
+  mypy::Interpreter::Options ast, vm, jit, unlimited;
+  vm.vm = true;
+  jit.jitThreshold = 0;
+  // the AST engine recurses natively: its own stack has to stop it
+  unlimited.recursionLimit = 1UL << 40;
+  errorsInCalls("ast", ast);
+  errorsInCalls("ast, no recursion limit", unlimited);
+  errorsInCalls("vm", vm);
+  errorsInCalls("jit", jit);
+  cacheOfEachFile();
+  if (failures) return 1;
+  std::cout << "embed_test: passed" << std::endl;
+  return 0;
+}